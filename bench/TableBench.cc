@@ -0,0 +1,150 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2025, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+// Micro-benchmark for table lookups.
+// Compares single point lookups with the batched point lookup and
+// per-table lookups with the batched lookup of tables that share axes.
+//
+//   make table_bench
+//   ./table_bench [point_count] [repeat_count]
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "LibertyClass.hh"
+#include "TableModel.hh"
+
+using sta::FloatSeq;
+using sta::FloatTable;
+using sta::Table;
+using sta::TableAxis;
+using sta::TableAxisPtr;
+using sta::TableAxisVariable;
+using sta::TableLookup;
+
+using Clock = std::chrono::steady_clock;
+
+static double
+elapsedNs(Clock::time_point start,
+          size_t lookup_count)
+{
+  std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+  return elapsed.count() / lookup_count;
+}
+
+static Table
+makeTable(TableAxisPtr axis1,
+          TableAxisPtr axis2,
+          float scale)
+{
+  FloatTable values;
+  for (size_t i = 0; i < axis1->size(); i++) {
+    FloatSeq row;
+    for (size_t j = 0; j < axis2->size(); j++)
+      row.push_back(scale * (axis1->axisValue(i) + 2.0F * axis2->axisValue(j)));
+    values.push_back(std::move(row));
+  }
+  return Table(std::move(values), axis1, axis2);
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+  size_t point_count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000;
+  size_t repeat_count = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 100;
+
+  // 7x7 nldm style table of slew x load.
+  auto slew_axis = std::make_shared<TableAxis>(
+      TableAxisVariable::input_net_transition,
+      FloatSeq{5e-12, 2e-11, 5e-11, 1e-10, 2e-10, 5e-10, 1e-9});
+  auto cap_axis = std::make_shared<TableAxis>(
+      TableAxisVariable::total_output_net_capacitance,
+      FloatSeq{5e-16, 1e-15, 5e-15, 1e-14, 5e-14, 1e-13, 5e-13});
+  Table delay = makeTable(slew_axis, cap_axis, 1.0);
+  Table slew = makeTable(slew_axis, cap_axis, 0.5);
+
+  std::mt19937 gen(17);
+  std::uniform_real_distribution<float> slews(0.0, 1.2e-9);
+  std::uniform_real_distribution<float> caps(0.0, 6e-13);
+  FloatSeq slew_values(point_count);
+  FloatSeq cap_values(point_count);
+  for (size_t i = 0; i < point_count; i++) {
+    slew_values[i] = slews(gen);
+    cap_values[i] = caps(gen);
+  }
+  FloatSeq values1(point_count);
+  FloatSeq values2(point_count);
+  size_t lookup_count = point_count * repeat_count;
+
+  Clock::time_point start = Clock::now();
+  for (size_t r = 0; r < repeat_count; r++) {
+    for (size_t i = 0; i < point_count; i++)
+      values1[i] = delay.findValue(slew_values[i], cap_values[i], 0.0);
+  }
+  double point_ns = elapsedNs(start, lookup_count);
+
+  start = Clock::now();
+  for (size_t r = 0; r < repeat_count; r++)
+    delay.findValues(point_count, slew_values.data(), cap_values.data(),
+                     nullptr, values2.data());
+  double points_ns = elapsedNs(start, lookup_count);
+  bool points_match = values1 == values2;
+
+  start = Clock::now();
+  for (size_t r = 0; r < repeat_count; r++) {
+    for (size_t i = 0; i < point_count; i++) {
+      TableLookup lookup(&delay, slew_values[i], cap_values[i], 0.0);
+      values1[i] = delay.findValue(lookup) + slew.findValue(lookup);
+    }
+  }
+  double tables_ns = elapsedNs(start, lookup_count);
+
+  const std::array<const Table *, 2> tables{&delay, &slew};
+  start = Clock::now();
+  for (size_t r = 0; r < repeat_count; r++) {
+    for (size_t i = 0; i < point_count; i++) {
+      TableLookup lookup(&delay, slew_values[i], cap_values[i], 0.0);
+      std::array<float, 2> values;
+      Table::findValues(lookup, tables, values.data());
+      values2[i] = values[0] + values[1];
+    }
+  }
+  double tables_batch_ns = elapsedNs(start, lookup_count);
+  bool tables_match = values1 == values2;
+
+  std::printf("point lookup       %8.2f ns/point\n", point_ns);
+  std::printf("point batch lookup %8.2f ns/point %s\n", points_ns,
+              points_match ? "match" : "differ");
+  std::printf("table lookup       %8.2f ns/delay+slew\n", tables_ns);
+  std::printf("table batch lookup %8.2f ns/delay+slew %s\n", tables_batch_ns,
+              tables_match ? "match" : "differ");
+  return (points_match && tables_match) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
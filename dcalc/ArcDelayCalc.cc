@@ -41,6 +41,23 @@ ArcDelayCalc::ArcDelayCalc(StaState *sta):
 {
 }
 
+ArcDcalcResultSeq
+ArcDelayCalc::gateDelayAPs(const Pin *drvr_pin,
+                           const TimingArc *arc,
+                           const ArcDcalcAPArgs &ap_args,
+                           const LoadPinIndexMap &load_pin_index_map)
+{
+  ArcDcalcResultSeq results;
+  results.reserve(ap_args.size());
+  for (size_t ap = 0; ap < ap_args.size(); ap++) {
+    results.push_back(gateDelay(drvr_pin, arc, ap_args.inSlew(ap),
+                                ap_args.loadCap(ap), ap_args.parasitic(ap),
+                                load_pin_index_map, ap_args.scene(ap),
+                                ap_args.minMax(ap)));
+  }
+  return results;
+}
+
 void
 ArcDelayCalc::gateDelay(const TimingArc *arc,
                         const Slew &in_slew,
@@ -302,4 +319,40 @@ ArcDcalcResult::setLoadSlew(size_t load_idx,
   load_slews_[load_idx] = load_slew;
 }
 
+////////////////////////////////////////////////////////////////
+
+void
+ArcDcalcAPArgs::clear()
+{
+  scenes_.clear();
+  min_maxes_.clear();
+  in_slews_.clear();
+  load_caps_.clear();
+  parasitics_.clear();
+}
+
+void
+ArcDcalcAPArgs::reserve(size_t ap_count)
+{
+  scenes_.reserve(ap_count);
+  min_maxes_.reserve(ap_count);
+  in_slews_.reserve(ap_count);
+  load_caps_.reserve(ap_count);
+  parasitics_.reserve(ap_count);
+}
+
+void
+ArcDcalcAPArgs::addAnalysisPt(const Scene *scene,
+                              const MinMax *min_max,
+                              const Slew &in_slew,
+                              float load_cap,
+                              const Parasitic *parasitic)
+{
+  scenes_.push_back(scene);
+  min_maxes_.push_back(min_max);
+  in_slews_.push_back(in_slew);
+  load_caps_.push_back(load_cap);
+  parasitics_.push_back(parasitic);
+}
+
 } // namespace sta
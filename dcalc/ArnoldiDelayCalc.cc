@@ -33,10 +33,12 @@
 #include <cstddef>
 #include <cstdio>
 #include <numbers>
+#include <vector>
 
 #include "ArcDelayCalc.hh"
 #include "Arnoldi.hh"
 #include "ArnoldiReduce.hh"
+#include "ContainerHelpers.hh"
 #include "Debug.hh"
 #include "DelayCalc.hh"
 #include "Graph.hh"
@@ -238,7 +240,12 @@ private:
                  double *c_x1,
                  double *c_y1);
 
+  // Model passed to gateDelay or inputPortDelay.
   rcmodel *rcmodel_{nullptr};
+  // Models reduced by findParasitic for each analysis point of the
+  // driver pin. gateDelayAPs is passed the parasitics of every analysis
+  // point, so they are kept until the driver pin is finished.
+  std::vector<rcmodel*> rcmodels_;
   int _pinNmax;
   double *_delayV;
   double *_slewV;
@@ -285,7 +292,7 @@ ArnoldiDelayCalc::~ArnoldiDelayCalc()
   free(_delayV);
   free(_slewV);
   delete reduce_;
-  delete rcmodel_;
+  deleteContents(rcmodels_);
 }
 
 Parasitic *
@@ -316,11 +323,12 @@ ArnoldiDelayCalc::findParasitic(const Pin *drvr_pin,
   }
     
   if (parasitic_network) {
-    rcmodel_ = reduce_->reduceToArnoldi(parasitic_network, drvr_pin,
-                                        parasitics->couplingCapFactor(),
-                                        drvr_rf, scene, min_max);
+    rcmodel *model = reduce_->reduceToArnoldi(parasitic_network, drvr_pin,
+                                              parasitics->couplingCapFactor(),
+                                              drvr_rf, scene, min_max);
     // Arnoldi parasitics are their own class that are not saved in the parasitic db.
-    parasitic = rcmodel_;
+    rcmodels_.push_back(model);
+    parasitic = model;
   }
   return parasitic;
 }
@@ -339,7 +347,7 @@ ArnoldiDelayCalc::reduceParasitic(const Parasitic *,
 void
 ArnoldiDelayCalc::finishDrvrPin()
 {
-  delete rcmodel_;
+  deleteContents(rcmodels_);
   rcmodel_ = nullptr;
 }
 
@@ -28,6 +28,8 @@
 
 #include "ArcDelayCalc.hh"
 #include "DelayCalc.hh"
+#include "Graph.hh"
+#include "GraphDelayCalc.hh"
 #include "Sta.hh"
 #include "dcalc/ArcDcalcWaveforms.hh"
 #include "dcalc/PrimaDelayCalc.hh"
@@ -71,6 +73,21 @@ report_delay_calc_cmd(Edge *edge,
   return sta->reportDelayCalc(edge, arc, scene, min_max, digits);
 }
 
+// Find the delays of one analysis point of an arc like delay
+// calculation does for parallel drivers.
+void
+find_arc_delays(Edge *edge,
+                TimingArc *arc,
+                const Scene *scene,
+                const MinMax *min_max)
+{
+  Sta *sta = Sta::sta();
+  sta->findDelays();
+  Vertex *drvr_vertex = edge->to(sta->graph());
+  sta->graphDelayCalc()->findDriverArcDelays(drvr_vertex, edge, arc, scene,
+                                             min_max, sta->arcDelayCalc());
+}
+
 void
 set_prima_reduce_order(size_t order)
 {
@@ -165,7 +165,7 @@ std::pair<double, double>
 DmpAlg::gateCapDelaySlew(double ceff)
 {
   float model_delay, model_slew;
-  gate_model_->gateDelay(pvt_, in_slew_, ceff, model_delay, model_slew);
+  gate_model_->gateDelay(pvt_, in_slew_, ceff, lookup_, model_delay, model_slew);
   double delay = model_delay;
   double slew = model_slew;
   return {delay, slew};
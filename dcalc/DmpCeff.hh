@@ -128,6 +128,9 @@ protected:
   const LibertyLibrary *drvr_library_;
   const Pvt *pvt_;
   const GateTableModel *gate_model_;
+  // Gate table axis positions kept across the Ceff iterations, which
+  // look up nearby loads at the same input slew.
+  TableLookup lookup_;
   double in_slew_;
   double c2_{0.0};
   double rpi_{0.0};
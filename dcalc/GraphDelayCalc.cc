@@ -343,6 +343,7 @@ GraphDelayCalc::findDelays(Level level)
   Stats stats(debug_, report_);
   int dcalc_count = 0;
   debugPrint(debug_, "delay_calc", 1, "find delays to level {}", level);
+  graph_->compactDelays();
   if (!delays_seeded_) {
     iter_->clear();
     seedRootSlews();
@@ -355,7 +356,10 @@ GraphDelayCalc::findDelays(Level level)
 
   if (!iter_->empty()) {
     FindVertexDelays visitor(this);
-    dcalc_count += iter_->visitParallel(level, &visitor);
+    if (variables_->dataflowPropagation())
+      dcalc_count += iter_->visitDataflow(level, &visitor);
+    else
+      dcalc_count += iter_->visitParallel(level, &visitor);
   }
 
   // Timing checks require slews at both ends of the arc,
@@ -367,6 +371,7 @@ GraphDelayCalc::findDelays(Level level)
   for (Edge *latch_edge : invalid_latch_edges_)
     findLatchEdgeDelays(latch_edge);
   invalid_latch_edges_.clear();
+  reportParasiticReadMessages();
 
   delays_exist_ = true;
   debugPrint(debug_, "delay_calc", 1, "found {} delays", dcalc_count);
@@ -437,6 +442,7 @@ GraphDelayCalc::seedDrvrSlew(Vertex *drvr_vertex,
       }
     }
   }
+  releaseParasiticNetworks(drvr_pin);
 }
 
 void
@@ -800,16 +806,47 @@ GraphDelayCalc::findDriverDelays(Vertex *drvr_vertex,
                                  LoadPinIndexMap &load_pin_index_map)
 {
   MultiDrvrNet *multi_drvr = findMultiDrvrNet(drvr_vertex);
+  bool found_delays = false;
   if (multi_drvr == nullptr) {
     initLoadSlews(drvr_vertex);
     findDriverDelays1(drvr_vertex, multi_drvr, arc_delay_calc, load_pin_index_map);
+    found_delays = true;
   }
   else if (drvr_vertex == multi_drvr->dcalcDrvr()) {
     initLoadSlews(drvr_vertex);
     for (Vertex *drvr : multi_drvr->drvrs())
       findDriverDelays1(drvr, multi_drvr, arc_delay_calc, load_pin_index_map);
+    found_delays = true;
   }
   arc_delay_calc->finishDrvrPin();
+  if (found_delays)
+    releaseParasiticNetworks(drvr_vertex->pin());
+}
+
+// Reduced parasitics are saved, so parasitic networks that can be
+// read again are not needed until the net is edited.
+void
+GraphDelayCalc::releaseParasiticNetworks(const Pin *drvr_pin)
+{
+  for (Scene *scene : scenes_) {
+    for (const MinMax *min_max : MinMax::range()) {
+      Parasitics *parasitics = scene->parasitics(min_max);
+      if (parasitics)
+        parasitics->releaseParasiticNetwork(drvr_pin);
+    }
+  }
+}
+
+void
+GraphDelayCalc::reportParasiticReadMessages()
+{
+  for (Scene *scene : scenes_) {
+    for (const MinMax *min_max : MinMax::range()) {
+      Parasitics *parasitics = scene->parasitics(min_max);
+      if (parasitics)
+        parasitics->reportNetworkReadMessages();
+    }
+  }
 }
 
 MultiDrvrNet *
@@ -992,6 +1029,7 @@ GraphDelayCalc::findLatchEdgeDelays(Edge *edge)
   bool delay_changed = findDriverEdgeDelays(drvr_vertex, nullptr, edge,
                                             arc_delay_calc_, load_pin_index_map,
                                             delay_exists);
+  arc_delay_calc_->finishDrvrPin();
   if (delay_changed && observer_)
     observer_->delayChangedTo(drvr_vertex);
 }
@@ -1009,20 +1047,29 @@ GraphDelayCalc::findDriverEdgeDelays(Vertex *drvr_vertex,
   const TimingArcSet *arc_set = edge->timingArcSet();
   bool delay_changed = false;
 
-  for (Scene *scene : scenes_) {
-    const Mode *mode = scene->mode();
-    if (search_pred_->searchFrom(from_vertex, mode)
-        && search_pred_->searchThru(edge, mode)) {
-      for (const MinMax *min_max : MinMax::range()) {
-        for (const TimingArc *arc : arc_set->arcs()) {
-          delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
-                                               scene, min_max, arc_delay_calc,
-                                               load_pin_index_map);
-          delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
+  if (multi_drvr
+      && multi_drvr->parallelGates(network_)) {
+    for (Scene *scene : scenes_) {
+      const Mode *mode = scene->mode();
+      if (search_pred_->searchFrom(from_vertex, mode)
+          && search_pred_->searchThru(edge, mode)) {
+        for (const MinMax *min_max : MinMax::range()) {
+          for (const TimingArc *arc : arc_set->arcs()) {
+            delay_changed |= findDriverArcDelays(drvr_vertex, multi_drvr, edge, arc,
+                                                 scene, min_max, arc_delay_calc,
+                                                 load_pin_index_map);
+            delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
+          }
         }
       }
     }
   }
+  else {
+    for (const TimingArc *arc : arc_set->arcs())
+      delay_changed |= findDriverArcDelaysAPs(drvr_vertex, multi_drvr, edge, arc,
+                                              arc_delay_calc, load_pin_index_map,
+                                              delay_exists);
+  }
   if (delay_changed && observer_) {
     observer_->delayChangedFrom(from_vertex);
     observer_->delayChangedFrom(drvr_vertex);
@@ -1095,6 +1142,53 @@ GraphDelayCalc::findDriverArcDelays(Vertex *drvr_vertex,
   return delay_changed;
 }
 
+bool
+GraphDelayCalc::findDriverArcDelaysAPs(Vertex *drvr_vertex,
+                                       const MultiDrvrNet *multi_drvr,
+                                       Edge *edge,
+                                       const TimingArc *arc,
+                                       ArcDelayCalc *arc_delay_calc,
+                                       LoadPinIndexMap &load_pin_index_map,
+                                       // Return value.
+                                       std::array<bool, RiseFall::index_count> &delay_exists)
+{
+  const Pin *drvr_pin = drvr_vertex->pin();
+  Vertex *from_vertex = edge->from(graph_);
+  const RiseFall *from_rf = arc->fromEdge()->asRiseFall();
+  const RiseFall *drvr_rf = arc->toEdge()->asRiseFall();
+  ArcDcalcAPArgs ap_args;
+  ap_args.reserve(scenes_.size() * MinMax::index_count);
+  for (Scene *scene : scenes_) {
+    const Mode *mode = scene->mode();
+    if (search_pred_->searchFrom(from_vertex, mode)
+        && search_pred_->searchThru(edge, mode)) {
+      if (from_rf && drvr_rf) {
+        for (const MinMax *min_max : MinMax::range()) {
+          const Parasitic *parasitic;
+          float load_cap;
+          parasiticLoad(drvr_pin, drvr_rf, scene, min_max, multi_drvr,
+                        arc_delay_calc, load_cap, parasitic);
+          const Slew in_slew = edgeFromSlew(from_vertex, from_rf, edge,
+                                            scene, min_max);
+          ap_args.addAnalysisPt(scene, min_max, in_slew, load_cap, parasitic);
+        }
+      }
+      delay_exists[arc->toEdge()->asRiseFall()->index()] = true;
+    }
+  }
+
+  bool delay_changed = false;
+  if (!ap_args.empty()) {
+    ArcDcalcResultSeq dcalc_results =
+      arc_delay_calc->gateDelayAPs(drvr_pin, arc, ap_args, load_pin_index_map);
+    for (size_t ap = 0; ap < ap_args.size(); ap++)
+      delay_changed |= annotateDelaysSlews(edge, arc, dcalc_results[ap],
+                                           load_pin_index_map, ap_args.scene(ap),
+                                           ap_args.minMax(ap));
+  }
+  return delay_changed;
+}
+
 ArcDcalcArgSeq
 GraphDelayCalc::makeArcDcalcArgs(Vertex *drvr_vertex,
                                  const MultiDrvrNet *multi_drvr,
@@ -39,6 +39,57 @@ ParallelDelayCalc::ParallelDelayCalc(StaState *sta):
 {
 }
 
+// The delays through an arc only depend on the gate model, pvt,
+// input slew and load, so analysis points that share all of them
+// (scenes of modes that share a corner) are only found once.
+ArcDcalcResultSeq
+ParallelDelayCalc::gateDelayAPs(const Pin *drvr_pin,
+                                const TimingArc *arc,
+                                const ArcDcalcAPArgs &ap_args,
+                                const LoadPinIndexMap &load_pin_index_map)
+{
+  size_t ap_count = ap_args.size();
+  ArcDcalcResultSeq results;
+  results.reserve(ap_count);
+  std::vector<const GateTimingModel*> models;
+  std::vector<const Pvt*> pvts;
+  models.reserve(ap_count);
+  pvts.reserve(ap_count);
+  for (size_t ap = 0; ap < ap_count; ap++) {
+    const Scene *scene = ap_args.scene(ap);
+    const MinMax *min_max = ap_args.minMax(ap);
+    models.push_back(arc->gateModel(scene, min_max));
+    pvts.push_back(pinPvt(drvr_pin, scene, min_max));
+    size_t ap1 = 0;
+    for (; ap1 < ap; ap1++) {
+      if (models[ap1] == models[ap]
+          && pvts[ap1] == pvts[ap]
+          && ap_args.minMax(ap1) == min_max
+          && ap_args.parasitic(ap1) == ap_args.parasitic(ap)
+          && ap_args.loadCap(ap1) == ap_args.loadCap(ap)
+          && slewsIdentical(ap_args.inSlew(ap1), ap_args.inSlew(ap)))
+        break;
+    }
+    if (ap1 < ap)
+      results.push_back(results[ap1]);
+    else
+      results.push_back(gateDelay(drvr_pin, arc, ap_args.inSlew(ap),
+                                  ap_args.loadCap(ap), ap_args.parasitic(ap),
+                                  load_pin_index_map, scene, min_max));
+  }
+  return results;
+}
+
+bool
+ParallelDelayCalc::slewsIdentical(const Slew &slew1,
+                                  const Slew &slew2)
+{
+  return slew1.mean() == slew2.mean()
+    && slew1.meanShift() == slew2.meanShift()
+    && slew1.stdDev2() == slew2.stdDev2()
+    && slew1.skewness() == slew2.skewness();
+}
+
 ArcDcalcResultSeq
 ParallelDelayCalc::gateDelays(ArcDcalcArgSeq &dcalc_args,
                               const LoadPinIndexMap &load_pin_index_map,
@@ -40,11 +40,17 @@ public:
                                const LoadPinIndexMap &load_pin_index_map,
                                const Scene *scene,
                                const MinMax *min_max) override;
+  ArcDcalcResultSeq gateDelayAPs(const Pin *drvr_pin,
+                                 const TimingArc *arc,
+                                 const ArcDcalcAPArgs &ap_args,
+                                 const LoadPinIndexMap &load_pin_index_map) override;
 protected:
   ArcDcalcResultSeq gateDelaysParallel(ArcDcalcArgSeq &dcalc_args,
                                        const LoadPinIndexMap &load_pin_index_map,
                                        const Scene *scene,
                                        const MinMax *min_max);
+  static bool slewsIdentical(const Slew &slew1,
+                             const Slew &slew2);
 };
 
 } // namespace sta
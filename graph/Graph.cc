@@ -24,8 +24,11 @@
 
 #include "Graph.hh"
 
+#include <algorithm>
+
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "FuncExpr.hh"
 #include "Liberty.hh"
 #include "MinMax.hh"
@@ -56,6 +59,7 @@ Graph::Graph(StaState *sta,
 {
   // For the benifit of reg_clk_vertices_ that references graph_.
   graph_ = this;
+  findDelayFloatCount();
 }
 
 Graph::~Graph()
@@ -71,8 +75,54 @@ void
 Graph::makeGraph()
 {
   Stats stats(debug_, report_);
-  makeVerticesAndEdges();
-  makeWireEdges();
+  if (thread_count_ > 1) {
+    makeVerticesAndEdgesParallel();
+    makeWireEdgesParallel();
+  }
+  else {
+    makeVerticesAndEdges();
+    makeWireEdges();
+  }
+  stats.report("Make graph");
+}
+
+void
+Graph::makeGraph(const PinSeq &pins)
+{
+  Stats stats(debug_, report_);
+  vertices_ = new VertexTable;
+  edges_ = new EdgeTable;
+  for (const Pin *pin : pins)
+    makePinVertices(const_cast<Pin*>(pin));
+
+  InstanceSet visited_insts(network_);
+  for (const Pin *pin : pins) {
+    const Instance *inst = network_->instance(pin);
+    if (!network_->isTopInstance(inst)
+        && !visited_insts.contains(inst)) {
+      visited_insts.insert(inst);
+      makeInstanceEdges(inst);
+    }
+  }
+  PinSet visited_drvrs(network_);
+  for (const Pin *pin : pins) {
+    if (network_->isDriver(pin)
+        && !visited_drvrs.contains(pin)) {
+      makeWireEdgesFromPin(pin, visited_drvrs);
+      // makeWireEdgesFromPin only marks the other drivers of the net,
+      // so mark this one to keep the instance pass below from making
+      // its wire edges again.
+      visited_drvrs.insert(pin);
+    }
+  }
+  // Remaining drivers and top level bidirect edges.
+  LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
+  while (inst_iter->hasNext()) {
+    Instance *inst = inst_iter->next();
+    makeInstDrvrWireEdges(inst, visited_drvrs);
+  }
+  delete inst_iter;
+  makeInstDrvrWireEdges(network_->topInstance(), visited_drvrs);
   stats.report("Make graph");
 }
 
@@ -96,6 +146,81 @@ Graph::makeVerticesAndEdges()
   makePinVertices(network_->topInstance());
 }
 
+// Make the same vertices and edges in the same order as
+// makeVerticesAndEdges so vertex and edge IDs do not depend on the
+// thread count. Vertices are made serially. The timing arc edges for
+// a batch of instances are found in parallel and made serially in
+// instance order.
+void
+Graph::makeVerticesAndEdgesParallel()
+{
+  vertices_ = new VertexTable;
+  edges_ = new EdgeTable;
+
+  LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
+  InstanceSeq insts;
+  std::vector<InstanceEdgeSeq> inst_edges;
+  while (nextLeafInstances(leaf_iter, insts)) {
+    for (const Instance *inst : insts)
+      makePinVertices(inst);
+    inst_edges.resize(insts.size());
+    dispatch_queue_->parallelFor(insts.size(), thread_count_,
+                                 make_graph_grain_size_,
+      [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          const Instance *inst = insts[i];
+          inst_edges[i].clear();
+          LibertyCell *cell = network_->libertyCell(inst);
+          if (cell)
+            findPortInstanceEdges(inst, cell, nullptr, inst_edges[i]);
+        }
+      });
+    for (size_t i = 0; i < insts.size(); i++)
+      makeInstanceEdges(inst_edges[i]);
+  }
+  delete leaf_iter;
+  makePinVertices(network_->topInstance());
+}
+
+// Same wire edges in the same order as makeWireEdges. The loads of
+// single driver nets are found in parallel. Nets with multiple drivers
+// are found serially because each driver would visit the whole net.
+void
+Graph::makeWireEdgesParallel()
+{
+  PinSet visited_drvrs(network_);
+  LeafInstanceIterator *inst_iter = network_->leafInstanceIterator();
+  InstanceSeq insts;
+  std::vector<DrvrLoadsSeq> inst_drvr_loads;
+  while (nextLeafInstances(inst_iter, insts)) {
+    inst_drvr_loads.resize(insts.size());
+    dispatch_queue_->parallelFor(insts.size(), thread_count_,
+                                 make_graph_grain_size_,
+      [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          inst_drvr_loads[i].clear();
+          findSingleDrvrLoads(insts[i], inst_drvr_loads[i]);
+        }
+      });
+    for (size_t i = 0; i < insts.size(); i++)
+      makeInstDrvrWireEdges(insts[i], inst_drvr_loads[i], visited_drvrs);
+  }
+  delete inst_iter;
+  makeInstDrvrWireEdges(network_->topInstance(), visited_drvrs);
+}
+
+size_t
+Graph::nextLeafInstances(LeafInstanceIterator *inst_iter,
+                         // Return value.
+                         InstanceSeq &insts) const
+{
+  insts.clear();
+  while (insts.size() < make_graph_batch_size_
+         && inst_iter->hasNext())
+    insts.push_back(inst_iter->next());
+  return insts.size();
+}
+
 class FindNetDrvrLoadCounts : public PinVisitor
 {
 public:
@@ -149,12 +274,9 @@ FindNetDrvrLoadCounts::operator()(const Pin *pin)
 void
 Graph::makePinVertices(const Instance *inst)
 {
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    Pin *pin = pin_iter->next();
+  network_->visitPins(inst, [this](Pin *pin) {
     makePinVertices(pin);
-  }
-  delete pin_iter;
+  });
 }
 
 // Make edges corresponding to library timing arcs.
@@ -183,6 +305,18 @@ void
 Graph::makePortInstanceEdges(const Instance *inst,
                              LibertyCell *cell,
                              LibertyPort *from_to_port)
+{
+  InstanceEdgeSeq edges;
+  findPortInstanceEdges(inst, cell, from_to_port, edges);
+  makeInstanceEdges(edges);
+}
+
+void
+Graph::findPortInstanceEdges(const Instance *inst,
+                             LibertyCell *cell,
+                             LibertyPort *from_to_port,
+                             // Return value.
+                             InstanceEdgeSeq &edges) const
 {
   for (TimingArcSet *arc_set : cell->timingArcSets()) {
     LibertyPort *from_port = arc_set->from();
@@ -207,27 +341,35 @@ Graph::makePortInstanceEdges(const Instance *inst,
           const TimingRole *role = arc_set->role();
           bool is_check = role->isTimingCheckBetween();
           if (to_bidirect_drvr_vertex && !is_check)
-            makeEdge(from_vertex, to_bidirect_drvr_vertex, arc_set);
-          else if (to_vertex) {
-            makeEdge(from_vertex, to_vertex, arc_set);
-            if (is_check) {
-              to_vertex->setHasChecks(true);
-              from_vertex->setIsCheckClk(true);
-            }
-          }
-          if (from_bidirect_drvr_vertex && to_vertex) {
+            edges.push_back({from_vertex, to_bidirect_drvr_vertex, arc_set,
+                             false, false});
+          else if (to_vertex)
+            edges.push_back({from_vertex, to_vertex, arc_set, is_check, false});
+          if (from_bidirect_drvr_vertex && to_vertex)
             // Internal path from bidirect output back into the
             // instance.
-            Edge *edge = makeEdge(from_bidirect_drvr_vertex, to_vertex,
-                                  arc_set);
-            edge->setIsBidirectInstPath(true);
-          }
+            edges.push_back({from_bidirect_drvr_vertex, to_vertex, arc_set,
+                             false, true});
         }
       }
     }
   }
 }
 
+void
+Graph::makeInstanceEdges(const InstanceEdgeSeq &edges)
+{
+  for (const InstanceEdge &inst_edge : edges) {
+    Edge *edge = makeEdge(inst_edge.from, inst_edge.to, inst_edge.arc_set);
+    if (inst_edge.is_check) {
+      inst_edge.to->setHasChecks(true);
+      inst_edge.from->setIsCheckClk(true);
+    }
+    if (inst_edge.is_bidirect_inst_path)
+      edge->setIsBidirectInstPath(true);
+  }
+}
+
 void
 Graph::makeWireEdges()
 {
@@ -245,9 +387,7 @@ void
 Graph::makeInstDrvrWireEdges(const Instance *inst,
                              PinSet &visited_drvrs)
 {
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    Pin *pin = pin_iter->next();
+  network_->visitPins(inst, [&](Pin *pin) {
     if (network_->isDriver(pin)
         && !visited_drvrs.contains(pin))
       makeWireEdgesFromPin(pin, visited_drvrs);
@@ -258,8 +398,51 @@ Graph::makeInstDrvrWireEdges(const Instance *inst,
       Edge *edge = makeEdge(bidir_load, bidir_drvr, TimingArcSet::wireTimingArcSet());
       edge->setIsBidirectPortPath(true);
     }
-  }
-  delete pin_iter;
+  });
+}
+
+void
+Graph::findSingleDrvrLoads(const Instance *inst,
+                           // Return value.
+                           DrvrLoadsSeq &drvr_loads) const
+{
+  network_->visitPins(inst, [&](const Pin *pin) {
+    if (network_->isDriver(pin)) {
+      PinSeq drvrs, loads;
+      PinSet visited_drvrs(network_);
+      FindNetDrvrLoads visitor(pin, visited_drvrs, loads, drvrs, network_);
+      network_->visitConnectedPins(pin, visitor);
+      if (drvrs.size() == 1)
+        drvr_loads.push_back({pin, std::move(loads)});
+    }
+  });
+}
+
+// makeInstDrvrWireEdges for a leaf instance using the loads found by
+// findSingleDrvrLoads.
+void
+Graph::makeInstDrvrWireEdges(const Instance *inst,
+                             const DrvrLoadsSeq &drvr_loads,
+                             PinSet &visited_drvrs)
+{
+  auto drvr_loads_iter = drvr_loads.begin();
+  network_->visitPins(inst, [&](const Pin *pin) {
+    bool found = drvr_loads_iter != drvr_loads.end()
+      && drvr_loads_iter->drvr == pin;
+    if (network_->isDriver(pin)
+        && !visited_drvrs.contains(pin)) {
+      if (found) {
+        for (const Pin *load_pin : drvr_loads_iter->loads) {
+          if (load_pin != pin)
+            makeWireEdge(pin, load_pin);
+        }
+      }
+      else
+        makeWireEdgesFromPin(pin, visited_drvrs);
+    }
+    if (found)
+      drvr_loads_iter++;
+  });
 }
 
 void
@@ -440,6 +623,11 @@ Graph::makeVertex(Pin *pin,
   Vertex *vertex = vertices_->make();
   vertex->init(pin, is_bidirect_drvr, is_reg_clk);
   initSlews(vertex);
+  if (!adjacency_.empty()) {
+    // Reused vertex IDs were marked changed when the vertex was deleted.
+    if (id(vertex) >= adjacency_.size())
+      adjacency_changed_count_++;
+  }
   if (is_reg_clk)
     reg_clk_vertices_.insert(vertex);
   return vertex;
@@ -490,6 +678,7 @@ Graph::deleteVertex(Vertex *vertex)
     Edge *edge = Graph::edge(edge_id);
     next_id = edge->vertex_in_next_;
     deleteOutEdge(edge->from(this), edge);
+    deleteArcDelays(edge);
     edge->clear();
     edges_->destroy(edge);
   }
@@ -498,9 +687,12 @@ Graph::deleteVertex(Vertex *vertex)
     Edge *edge = Graph::edge(edge_id);
     next_id = edge->vertex_out_next_;
     deleteInEdge(edge->to(this), edge);
+    deleteArcDelays(edge);
     edge->clear();
     edges_->destroy(edge);
   }
+  adjacencyChanged(vertex);
+  delay_arena_.destroy(vertex->slews_, slewCount() * delay_float_count_);
   vertex->clear();
   vertices_->destroy(vertex);
 }
@@ -516,6 +708,7 @@ void
 Graph::deleteInEdge(Vertex *vertex,
                     Edge *edge)
 {
+  adjacencyChanged(vertex);
   EdgeId edge_id = id(edge);
   EdgeId prev = 0;
   for (EdgeId i = vertex->in_edges_;
@@ -532,6 +725,7 @@ void
 Graph::deleteOutEdge(Vertex *vertex,
                      Edge *edge)
 {
+  adjacencyChanged(vertex);
   EdgeId next = edge->vertex_out_next_;
   EdgeId prev = edge->vertex_out_prev_;
   if (prev)
@@ -651,26 +845,14 @@ Graph::slew(const Vertex *vertex,
             DcalcAPIndex ap_index)
 {
   size_t slew_index = ap_index * RiseFall::index_count + rf->index();
-  const float *slews_flt = vertex->slewsFloat();
-  if (variables_->pocvEnabled()) {
-    const Slew *slews = reinterpret_cast<const Slew*>(slews_flt);
-    return slews[slew_index];
-  }
-  else
-    return slews_flt[slew_index];
+  return storedDelay(vertex->slewsFloat(), slew_index);
 }
 
 Slew
 Graph::slew(const Vertex *vertex,
             size_t index)
 {
-  const float *slews_flt = vertex->slewsFloat();
-  if (variables_->pocvEnabled()) {
-    const Slew *slews = reinterpret_cast<const Slew*>(slews_flt);
-    return slews[index];
-  }
-  else
-    return slews_flt[index];
+  return storedDelay(vertex->slewsFloat(), index);
 }
 
 void
@@ -680,13 +862,34 @@ Graph::setSlew(Vertex *vertex,
                const Slew &slew)
 {
   size_t slew_index = ap_index * RiseFall::index_count + rf->index();
-  if (variables_->pocvEnabled()) {
-    Slew *slews = vertex->slews();
-    slews[slew_index] = slew;
+  setStoredDelay(vertex->slewsFloat(), slew_index, slew);
+}
+
+Delay
+Graph::storedDelay(const float *delays,
+                   size_t index) const
+{
+  if (delay_float_count_ == 1)
+    return delays[index];
+  else {
+    const float *values = &delays[index * delay_float_count_];
+    return Delay(values[0], values[1], values[2], values[3]);
   }
+}
+
+void
+Graph::setStoredDelay(float *delays,
+                      size_t index,
+                      const Delay &delay)
+{
+  if (delay_float_count_ == 1)
+    delays[index] = delay.mean();
   else {
-    float *slews_flt = vertex->slewsFloat();
-    slews_flt[slew_index] = slew.mean();
+    float *values = &delays[index * delay_float_count_];
+    values[0] = delay.mean();
+    values[1] = delay.meanShift();
+    values[2] = delay.stdDev2();
+    values[3] = delay.skewness();
   }
 }
 
@@ -723,6 +926,8 @@ Graph::makeEdge(Vertex *from,
   // Add in edge to to vertex.
   edge->vertex_in_next_ = to->in_edges_;
   to->in_edges_ = edge_id;
+  adjacencyChanged(from);
+  adjacencyChanged(to);
 
   initArcDelays(edge);
   return edge;
@@ -735,24 +940,115 @@ Graph::deleteEdge(Edge *edge)
   Vertex *to = edge->to(this);
   deleteOutEdge(from, edge);
   deleteInEdge(to, edge);
+  deleteArcDelays(edge);
   edge->clear();
   edges_->destroy(edge);
 }
 
+////////////////////////////////////////////////////////////////
+
+void
+Graph::makeAdjacency()
+{
+  Stats stats(debug_, report_);
+  // Lay out the edge arrays in the order the BFS visits them.
+  VertexSeq level_vertices = levelSortedVertices();
+  adjacency_.assign(vertexIdBound(),
+                    VertexAdjacency{adjacency_changed_, 0, 0, 0});
+  adjacency_out_edges_.clear();
+  adjacency_out_edges_.reserve(edges_->size());
+  adjacency_in_edges_.clear();
+  adjacency_in_edges_.reserve(edges_->size());
+  for (Vertex *vertex : level_vertices) {
+    VertexAdjacency &adj = adjacency_[id(vertex)];
+    // Copy the edge lists in list order so iteration order does not change.
+    adj.out_begin = adjacency_out_edges_.size();
+    for (EdgeId edge_id = vertex->out_edges_;
+         edge_id;
+         edge_id = edge(edge_id)->vertex_out_next_)
+      adjacency_out_edges_.push_back(edge_id);
+    adj.out_end = adjacency_out_edges_.size();
+    adj.in_begin = adjacency_in_edges_.size();
+    for (EdgeId edge_id = vertex->in_edges_;
+         edge_id;
+         edge_id = edge(edge_id)->vertex_in_next_)
+      adjacency_in_edges_.push_back(edge_id);
+    adj.in_end = adjacency_in_edges_.size();
+  }
+  adjacency_changed_count_ = 0;
+  debugPrint(debug_, "graph", 1, "adjacency {} vertices {} edges",
+             level_vertices.size(), adjacency_out_edges_.size());
+  stats.report("Make adjacency");
+}
+
+VertexSeq
+Graph::levelSortedVertices()
+{
+  VertexSeq vertices;
+  vertices.reserve(vertices_->size());
+  Level max_level = 0;
+  VertexIterator vertex_iter(this);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    vertices.push_back(vertex);
+    max_level = std::max(max_level, vertex->level());
+  }
+  // Counting sort so vertices in a level stay in iteration order.
+  std::vector<size_t> level_starts(max_level + 2, 0);
+  for (Vertex *vertex : vertices)
+    level_starts[std::max(vertex->level(), 0) + 1]++;
+  for (Level level = 0; level <= max_level; level++)
+    level_starts[level + 1] += level_starts[level];
+  VertexSeq sorted(vertices.size());
+  for (Vertex *vertex : vertices)
+    sorted[level_starts[std::max(vertex->level(), 0)]++] = vertex;
+  return sorted;
+}
+
+void
+Graph::ensureAdjacency()
+{
+  if (vertices_
+      && (adjacency_.empty()
+          || adjacency_changed_count_
+          > vertices_->size() / adjacency_remake_ratio_))
+    makeAdjacency();
+}
+
+const VertexAdjacency *
+Graph::adjacency(const Vertex *vertex) const
+{
+  VertexId vertex_id = vertices_->objectId(vertex);
+  if (vertex_id < adjacency_.size()) {
+    const VertexAdjacency &adj = adjacency_[vertex_id];
+    if (adj.out_begin != adjacency_changed_)
+      return &adj;
+  }
+  return nullptr;
+}
+
+void
+Graph::adjacencyChanged(const Vertex *vertex)
+{
+  VertexId vertex_id = vertices_->objectId(vertex);
+  if (vertex_id < adjacency_.size()) {
+    VertexAdjacency &adj = adjacency_[vertex_id];
+    if (adj.out_begin != adjacency_changed_) {
+      adj.out_begin = adjacency_changed_;
+      adjacency_changed_count_++;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 ArcDelay
 Graph::arcDelay(const Edge *edge,
                 const TimingArc *arc,
                 DcalcAPIndex ap_index) const
 {
   size_t index = arc->index() * ap_count_ + ap_index;
-  if (variables_->pocvEnabled()) {
-    const ArcDelay *delays = reinterpret_cast<const ArcDelay*>(edge->arcDelays());
-    return delays[index];
-  }
-  else {
-    const float *delays = edge->arcDelays();
-    return delays[index];
-  }
+  return storedDelay(edge->arcDelays(), index);
 }
 
 void
@@ -762,14 +1058,7 @@ Graph::setArcDelay(Edge *edge,
                    const ArcDelay &delay)
 {
   size_t index = arc->index() * ap_count_ + ap_index;
-  if (variables_->pocvEnabled()) {
-    ArcDelay *delays = reinterpret_cast<ArcDelay*>(edge->arcDelays());
-    delays[index] = delay;
-  }
-  else {
-    float *delays = edge->arcDelays();
-    delays[index] = delay.mean();
-  }
+  setStoredDelay(edge->arcDelays(), index, delay);
 }
 
 ArcDelay
@@ -778,14 +1067,7 @@ Graph::wireArcDelay(const Edge *edge,
                     DcalcAPIndex ap_index)
 {
   size_t index = rf->index() * ap_count_ + ap_index;
-  if (variables_->pocvEnabled()) {
-    const ArcDelay *delays = reinterpret_cast<const ArcDelay*>(edge->arcDelays());
-    return delays[index];
-  }
-  else {
-    const float *delays = edge->arcDelays();
-    return delays[index];
-  }
+  return storedDelay(edge->arcDelays(), index);
 }
 
 void
@@ -795,14 +1077,7 @@ Graph::setWireArcDelay(Edge *edge,
                        const ArcDelay &delay)
 {
   size_t index = rf->index() * ap_count_ + ap_index;
-  if (variables_->pocvEnabled()) {
-    ArcDelay *delays = reinterpret_cast<ArcDelay*>(edge->arcDelays());
-    delays[index] = delay;
-  }
-  else {
-    float *delays = edge->arcDelays();
-    delays[index] = delay.mean();
-  }
+  setStoredDelay(edge->arcDelays(), index, delay);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -857,14 +1132,25 @@ void
 Graph::delayCountChanged()
 {
   ap_count_ = dcalcAnalysisPtCount();
+  findDelayFloatCount();
   // Discard any existing delays.
   removePeriodCheckAnnotations();
   initSlews();
 }
 
+void
+Graph::findDelayFloatCount()
+{
+  if (variables_->pocvEnabled())
+    delay_float_count_ = sizeof(Delay) / sizeof(float);
+  else
+    delay_float_count_ = 1;
+}
+
 void
 Graph::initSlews()
 {
+  delay_arena_.clear();
   VertexIterator vertex_iter(graph_);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
@@ -881,15 +1167,8 @@ Graph::initSlews()
 void
 Graph::initSlews(Vertex *vertex)
 {
-  size_t slew_count = slewCount();
-  if (variables_->pocvEnabled()) {
-    float *slews = reinterpret_cast<float*>(new Slew[slew_count]{});
-    vertex->setSlews(slews);
-  }
-  else {
-    float *slews = new float[slew_count]{};
-    vertex->setSlews(slews);
-  }
+  size_t float_count = slewCount() * delay_float_count_;
+  vertex->setSlews(delay_arena_.make(float_count));
 }
 
 size_t
@@ -900,16 +1179,50 @@ Graph::slewCount()
 
 void
 Graph::initArcDelays(Edge *edge)
+{
+  edge->setArcDelays(delay_arena_.make(arcDelayFloatCount(edge)));
+}
+
+size_t
+Graph::arcDelayFloatCount(const Edge *edge) const
 {
   size_t arc_count = edge->timingArcSet()->arcCount();
-  size_t delay_count = arc_count * ap_count_;
-  if (variables_->pocvEnabled()) {
-    float *delays = reinterpret_cast<float*>(new ArcDelay[delay_count]{});
-    edge->setArcDelays(delays);
-  }
-  else {
-    float *delays = new float[delay_count]{};
-    edge->setArcDelays(delays);
+  return arc_count * ap_count_ * delay_float_count_;
+}
+
+void
+Graph::deleteArcDelays(Edge *edge)
+{
+  delay_arena_.destroy(edge->arc_delays_, arcDelayFloatCount(edge));
+  edge->arc_delays_ = nullptr;
+}
+
+void
+Graph::compactDelays()
+{
+  if (delay_arena_.blockCount() > 1
+      && delay_arena_.freeCount() > delay_arena_.capacity() / 2) {
+    Stats stats(debug_, report_);
+    ArrayArena<float> arena;
+    size_t slew_float_count = slewCount() * delay_float_count_;
+    for (Vertex *vertex : levelSortedVertices()) {
+      float *slews = arena.make(slew_float_count);
+      std::copy(vertex->slews_, vertex->slews_ + slew_float_count, slews);
+      vertex->setSlews(slews);
+
+      VertexOutEdgeIterator edge_iter(vertex, this);
+      while (edge_iter.hasNext()) {
+        Edge *edge = edge_iter.next();
+        size_t float_count = arcDelayFloatCount(edge);
+        float *delays = arena.make(float_count);
+        std::copy(edge->arc_delays_, edge->arc_delays_ + float_count, delays);
+        edge->setArcDelays(delays);
+      }
+    }
+    debugPrint(debug_, "graph", 1, "compact delays {} -> {} floats",
+               delay_arena_.capacity(), arena.capacity());
+    delay_arena_ = std::move(arena);
+    stats.report("Compact delays");
   }
 }
 
@@ -1022,6 +1335,122 @@ Graph::removeDelaySlewAnnotations()
   removePeriodCheckAnnotations();
 }
 
+void
+Graph::saveAnnotations(GraphAnnotations &annotations)
+{
+  VertexIterator vertex_iter(this);
+  while (vertex_iter.hasNext()) {
+    Vertex *vertex = vertex_iter.next();
+    GraphAnnotations::VertexKey from_key{vertex->pin(),
+                                         vertex->isBidirectDriver()};
+    if (vertex->slewAnnotated()) {
+      SlewSeq slews;
+      for (size_t i = 0; i < slewCount(); i++)
+        slews.push_back(slew(vertex, i));
+      annotations.vertex_slews_.push_back({from_key,
+                                           vertex->slew_annotated_,
+                                           std::move(slews)});
+    }
+    VertexOutEdgeIterator edge_iter(vertex, this);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      std::vector<GraphAnnotations::ArcDelayAnnotation> delays;
+      for (const TimingArc *arc : edge->timingArcSet()->arcs()) {
+        for (DcalcAPIndex ap_index = 0; ap_index < ap_count_; ap_index++) {
+          if (arcDelayAnnotated(edge, arc, ap_index))
+            delays.push_back({arc, ap_index, arcDelay(edge, arc, ap_index)});
+        }
+      }
+      if (!delays.empty()) {
+        Vertex *to_vertex = edge->to(this);
+        GraphAnnotations::VertexKey to_key{to_vertex->pin(),
+                                           to_vertex->isBidirectDriver()};
+        annotations.edge_delays_.push_back({from_key, to_key,
+                                            edge->timingArcSet(),
+                                            edge->delay_Annotation_Is_Incremental(),
+                                            std::move(delays)});
+      }
+    }
+  }
+  std::swap(annotations.period_checks_, period_check_annotations_);
+}
+
+void
+Graph::restoreAnnotations(GraphAnnotations &annotations)
+{
+  auto find_vertex = [this] (const GraphAnnotations::VertexKey &key) {
+    return key.is_bidirect_drvr
+      ? pinDrvrVertex(key.pin)
+      : pinLoadVertex(key.pin);
+  };
+  for (const auto &vertex_slews : annotations.vertex_slews_) {
+    Vertex *vertex = find_vertex(vertex_slews.vertex);
+    for (size_t i = 0; i < vertex_slews.slews.size(); i++)
+      setStoredDelay(vertex->slewsFloat(), i, vertex_slews.slews[i]);
+    vertex->slew_annotated_ = vertex_slews.slew_annotated;
+  }
+  for (const auto &edge_delays : annotations.edge_delays_) {
+    Vertex *from_vertex = find_vertex(edge_delays.from);
+    Vertex *to_vertex = find_vertex(edge_delays.to);
+    VertexOutEdgeIterator edge_iter(from_vertex, this);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      if (edge->to(this) == to_vertex
+          && edge->timingArcSet() == edge_delays.arc_set) {
+        for (const auto &arc_delay : edge_delays.delays) {
+          setArcDelay(edge, arc_delay.arc, arc_delay.ap_index,
+                      arc_delay.delay);
+          setArcDelayAnnotated(edge, arc_delay.arc, arc_delay.ap_index,
+                               true);
+        }
+        edge->setDelayAnnotationIsIncremental(edge_delays.is_incremental);
+        break;
+      }
+    }
+  }
+  removePeriodCheckAnnotations();
+  std::swap(annotations.period_checks_, period_check_annotations_);
+  annotations.vertex_slews_.clear();
+  annotations.edge_delays_.clear();
+}
+
+GraphAnnotations::~GraphAnnotations()
+{
+  for (auto& [pin, periods] : period_checks_)
+    delete [] periods;
+}
+
+bool
+GraphAnnotations::empty() const
+{
+  return vertex_slews_.empty()
+    && edge_delays_.empty()
+    && period_checks_.empty();
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+Graph::setHasSimValue(Vertex *vertex)
+{
+  if (!vertex->hasSimValue())
+    vertex->setHasSimValue(true);
+}
+
+void
+Graph::setHasSimSense(Edge *edge)
+{
+  if (!edge->hasSimSense())
+    edge->setHasSimSense(true);
+}
+
+void
+Graph::setHasDisabledCond(Edge *edge)
+{
+  if (!edge->hasDisabledCond())
+    edge->setHasDisabledCond(true);
+}
+
 ////////////////////////////////////////////////////////////////
 //
 // Vertex
@@ -1052,7 +1481,7 @@ Vertex::init(Pin *pin,
   has_downstream_clk_pin_ = false;
   visited1_ = false;
   visited2_ = false;
-  has_sim_value_ = false;
+  has_sim_value_.store(false, std::memory_order_relaxed);
   level_ = 0;
   slew_annotated_ = false;
   bfs_in_queue_ = 0;
@@ -1067,9 +1496,8 @@ Vertex::~Vertex()
 void
 Vertex::clear()
 {
-  delete [] slews_;
+  // Slews are owned by the graph delay arena and paths by Search.
   slews_ = nullptr;
-  delete [] paths_;
   paths_ = nullptr;
 }
 
@@ -1154,14 +1582,13 @@ Vertex::setVisited2(bool visited)
 void
 Vertex::setSlews(float *slews)
 {
-  delete [] slews_;
   slews_ = slews;
 }
 
 void
 Vertex::setHasSimValue(bool has_sim)
 {
-  has_sim_value_ = has_sim;
+  has_sim_value_.store(has_sim, std::memory_order_relaxed);
 }
 
 bool
@@ -1212,26 +1639,15 @@ Vertex::setTagGroupIndex(TagGroupIndex tag_index)
   tag_group_index_ = tag_index;
 }
 
-Path *
-Vertex::makePaths(uint32_t count)
-{
-  delete [] paths_;
-  Path *paths = new Path[count];
-  paths_ = paths;
-  return paths;
-}
-
 void
 Vertex::setPaths(Path *paths)
 {
-  delete [] paths_;
   paths_ = paths;
 }
 
 void
 Vertex::deletePaths()
 {
-  delete [] paths_;
   paths_ = nullptr;
   tag_group_index_ = tag_group_index_max;
 }
@@ -1319,8 +1735,8 @@ Edge::init(VertexId from,
   is_bidirect_net_path_ = false;
   is_bidirect_port_path_ = false;
   is_disabled_loop_ = false;
-  has_sim_sense_ = false;
-  has_disabled_cond_ = false;
+  has_sim_sense_.store(false, std::memory_order_relaxed);
+  has_disabled_cond_.store(false, std::memory_order_relaxed);
 }
 
 Edge::~Edge()
@@ -1331,7 +1747,7 @@ Edge::~Edge()
 void
 Edge::clear()
 {
-  delete [] arc_delays_;
+  // Arc delays are owned by the graph delay arena.
   arc_delays_ = nullptr;
   if (!arc_delay_annotated_is_bits_)
     delete arc_delay_annotated_.seq_;
@@ -1371,7 +1787,6 @@ Edge::setTimingArcSet(TimingArcSet *set)
 void
 Edge::setArcDelays(float *delays)
 {
-  delete [] arc_delays_;
   arc_delays_ = delays;
 }
 
@@ -1479,13 +1894,13 @@ Edge::setIsBidirectPortPath(bool is_bidir)
 void
 Edge::setHasSimSense(bool has_sense)
 {
-  has_sim_sense_ = has_sense;
+  has_sim_sense_.store(has_sense, std::memory_order_relaxed);
 }
 
 void
 Edge::setHasDisabledCond(bool has_disabled)
 {
-  has_disabled_cond_ = has_disabled;
+  has_disabled_cond_.store(has_disabled, std::memory_order_relaxed);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1562,39 +1977,65 @@ VertexIterator::findNext()
 
 VertexInEdgeIterator::VertexInEdgeIterator(Vertex *vertex,
                                            const Graph *graph) :
-  next_(graph->edge(vertex->in_edges_)),
   graph_(graph)
 {
+  init(vertex);
 }
 
 VertexInEdgeIterator::VertexInEdgeIterator(VertexId vertex_id,
                                            const Graph *graph) :
-  next_(graph->edge(graph->vertex(vertex_id)->in_edges_)),
   graph_(graph)
 {
+  init(graph->vertex(vertex_id));
+}
+
+void
+VertexInEdgeIterator::init(const Vertex *vertex)
+{
+  const VertexAdjacency *adj = graph_->adjacency(vertex);
+  if (adj) {
+    const EdgeId *edge_ids = graph_->adjacency_in_edges_.data();
+    ids_ = edge_ids + adj->in_begin;
+    ids_end_ = edge_ids + adj->in_end;
+    next_ = (ids_ != ids_end_) ? graph_->edge(*ids_++) : nullptr;
+  }
+  else
+    next_ = graph_->edge(vertex->in_edges_);
 }
 
 Edge *
 VertexInEdgeIterator::next()
 {
   Edge *next = next_;
-  if (next_)
+  if (ids_)
+    next_ = (ids_ != ids_end_) ? graph_->edge(*ids_++) : nullptr;
+  else if (next_)
     next_ = graph_->edge(next_->vertex_in_next_);
   return next;
 }
 
 VertexOutEdgeIterator::VertexOutEdgeIterator(Vertex *vertex,
                                              const Graph *graph) :
-  next_(graph->edge(vertex->out_edges_)),
   graph_(graph)
 {
+  const VertexAdjacency *adj = graph->adjacency(vertex);
+  if (adj) {
+    const EdgeId *edge_ids = graph->adjacency_out_edges_.data();
+    ids_ = edge_ids + adj->out_begin;
+    ids_end_ = edge_ids + adj->out_end;
+    next_ = (ids_ != ids_end_) ? graph->edge(*ids_++) : nullptr;
+  }
+  else
+    next_ = graph->edge(vertex->out_edges_);
 }
 
 Edge *
 VertexOutEdgeIterator::next()
 {
   Edge *next = next_;
-  if (next_)
+  if (ids_)
+    next_ = (ids_ != ids_end_) ? graph_->edge(*ids_++) : nullptr;
+  else if (next_)
     next_ = graph_->edge(next_->vertex_out_next_);
   return next;
 }
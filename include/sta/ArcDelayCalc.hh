@@ -142,6 +142,36 @@ protected:
 
 using ArcDcalcResultSeq = std::vector<ArcDcalcResult>;
 
+// Arguments for gate delay calculation through one timing arc at
+// several delay calc analysis points (scene/min_max). Each argument is
+// kept in its own array indexed by analysis point.
+class ArcDcalcAPArgs
+{
+public:
+  void clear();
+  void reserve(size_t ap_count);
+  void addAnalysisPt(const Scene *scene,
+                     const MinMax *min_max,
+                     const Slew &in_slew,
+                     // Pass in load_cap or parasitic.
+                     float load_cap,
+                     const Parasitic *parasitic);
+  size_t size() const { return scenes_.size(); }
+  bool empty() const { return scenes_.empty(); }
+  const Scene *scene(size_t ap) const { return scenes_[ap]; }
+  const MinMax *minMax(size_t ap) const { return min_maxes_[ap]; }
+  const Slew &inSlew(size_t ap) const { return in_slews_[ap]; }
+  float loadCap(size_t ap) const { return load_caps_[ap]; }
+  const Parasitic *parasitic(size_t ap) const { return parasitics_[ap]; }
+
+protected:
+  std::vector<const Scene*> scenes_;
+  std::vector<const MinMax*> min_maxes_;
+  std::vector<Slew> in_slews_;
+  std::vector<float> load_caps_;
+  std::vector<const Parasitic*> parasitics_;
+};
+
 // Delay calculator class hierarchy.
 //  ArcDelayCalc
 //   UnitDelayCalc
@@ -225,6 +255,17 @@ public:
                          ArcDelay &gate_delay,
                          Slew &drvr_slew) __attribute__ ((deprecated));
 
+  // Find the delay and slew for arc driving drvr_pin at each analysis
+  // point in ap_args. The results are indexed like ap_args.
+  // The parasitics in ap_args are found before any of the delays, so
+  // the caller finishes the driver pin (finishDrvrPin) after all of
+  // the analysis points.
+  // The default calls gateDelay for each analysis point.
+  virtual ArcDcalcResultSeq gateDelayAPs(const Pin *drvr_pin,
+                                         const TimingArc *arc,
+                                         const ArcDcalcAPArgs &ap_args,
+                                         const LoadPinIndexMap &load_pin_index_map);
+
   // Find gate delays and slews for parallel gates.
   virtual ArcDcalcResultSeq gateDelays(ArcDcalcArgSeq &args,
                                        const LoadPinIndexMap &load_pin_index_map,
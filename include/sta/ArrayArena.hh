@@ -0,0 +1,135 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sta {
+
+// Allocates arrays of TYPE from large blocks so that each array does
+// not need its own heap allocation. Destroyed arrays are kept on free
+// lists by array size and reused. Not thread safe.
+template <class TYPE,
+          size_t BLOCK_SIZE = (1 << 16)>
+class ArrayArena
+{
+public:
+  ArrayArena() = default;
+  ArrayArena(ArrayArena &&arena) = default;
+  ArrayArena &operator=(ArrayArena &&arena) = default;
+  // Array of count default constructed objects.
+  TYPE *make(size_t count);
+  void destroy(TYPE *objects,
+               size_t count);
+  // Free all of the arrays.
+  void clear();
+  // Objects in blocks, including unused ones.
+  size_t capacity() const { return capacity_; }
+  // Objects in arrays that have not been destroyed.
+  size_t size() const { return used_count_ - free_count_; }
+  // Objects in destroyed arrays.
+  size_t freeCount() const { return free_count_; }
+  size_t blockCount() const { return blocks_.size(); }
+
+private:
+  std::vector<std::unique_ptr<TYPE[]>> blocks_;
+  // Unused objects at the end of the last block.
+  TYPE *next_{nullptr};
+  size_t next_count_{0};
+  // Destroyed arrays indexed by array size.
+  std::vector<std::vector<TYPE*>> free_lists_;
+  size_t capacity_{0};
+  size_t used_count_{0};
+  size_t free_count_{0};
+};
+
+template <class TYPE,
+          size_t BLOCK_SIZE>
+TYPE *
+ArrayArena<TYPE, BLOCK_SIZE>::make(size_t count)
+{
+  if (count == 0)
+    return nullptr;
+  if (count < free_lists_.size()) {
+    std::vector<TYPE*> &free_list = free_lists_[count];
+    if (!free_list.empty()) {
+      TYPE *objects = free_list.back();
+      free_list.pop_back();
+      free_count_ -= count;
+      std::fill(objects, objects + count, TYPE());
+      return objects;
+    }
+  }
+  used_count_ += count;
+  if (count > next_count_) {
+    // Arrays larger than a block get a block of their own so the rest
+    // of the current block is not wasted.
+    size_t block_count = std::max(count, BLOCK_SIZE);
+    blocks_.push_back(std::make_unique<TYPE[]>(block_count));
+    capacity_ += block_count;
+    TYPE *block = blocks_.back().get();
+    if (count >= BLOCK_SIZE)
+      return block;
+    next_ = block;
+    next_count_ = block_count;
+  }
+  TYPE *objects = next_;
+  next_ += count;
+  next_count_ -= count;
+  return objects;
+}
+
+template <class TYPE,
+          size_t BLOCK_SIZE>
+void
+ArrayArena<TYPE, BLOCK_SIZE>::destroy(TYPE *objects,
+                                      size_t count)
+{
+  if (objects) {
+    if (count >= free_lists_.size())
+      free_lists_.resize(count + 1);
+    free_lists_[count].push_back(objects);
+    free_count_ += count;
+  }
+}
+
+template <class TYPE,
+          size_t BLOCK_SIZE>
+void
+ArrayArena<TYPE, BLOCK_SIZE>::clear()
+{
+  blocks_.clear();
+  next_ = nullptr;
+  next_count_ = 0;
+  free_lists_.clear();
+  capacity_ = 0;
+  used_count_ = 0;
+  free_count_ = 0;
+}
+
+} // namespace sta
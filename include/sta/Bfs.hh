@@ -25,6 +25,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -38,6 +39,7 @@ namespace sta {
 class SearchPred;
 class BfsFwdIterator;
 class BfsBkwdIterator;
+class BfsDataflow;
 
 using VertexFn = std::function<void(Vertex*)>;
 
@@ -108,6 +110,7 @@ protected:
   void checkLevel(Vertex *vertex,
                   Level level);
   void findNext(Level to_level);
+  bool dataflowEnqueue(Vertex *vertex);
 
   BfsIndex bfs_index_;
   Level level_min_;
@@ -120,6 +123,15 @@ protected:
   // Max (min) level of queued vertices.
   Level last_level_;
 
+  // visitParallel visits levels with fewer vertices than
+  // thread_count * min_vertices_per_thread_ in the calling thread.
+  static constexpr size_t min_vertices_per_thread_ = 4;
+  // Target number of chunks per thread for parallel levels.
+  static constexpr size_t chunks_per_thread_ = 8;
+  static constexpr size_t max_grain_size_ = 64;
+  // Non-null while BfsFwdIterator::visitDataflow is running.
+  BfsDataflow *dataflow_{nullptr};
+
   friend class BfsFwdIterator;
   friend class BfsBkwdIterator;
 };
@@ -138,6 +150,15 @@ public:
   void enqueueFanout(Vertex *vertex);
   void enqueueFanout(Vertex *vertex,
                      const Mode *mode);
+  // Apply visitor to the vertices in the queue thru to_level using
+  // threads, visiting each vertex as soon as the vertices in its fanin
+  // are finished instead of waiting for the entire previous level.
+  // Vertices that are enqueued outside of the fanout of the queued
+  // vertices are visited level by level afterwards.
+  // visitor must be thread safe.
+  // Returns the number of vertices that are visited.
+  int visitDataflow(Level to_level,
+                    VertexVisitor *visitor);
 
 protected:
   bool levelLessOrEqual(Level level1,
@@ -145,6 +166,22 @@ protected:
   bool levelLess(Level level1,
 		 Level level2) const override;
   void incrLevel(Level &level) const override;
+  size_t findDataflowFanout(Level to_level,
+                            BfsDataflow &dataflow,
+                            // Return value.
+                            VertexSeq &ready);
+  bool isDataflowEdge(Vertex *from_vertex,
+                      Vertex *to_vertex,
+                      Level to_level) const;
+  bool visitDataflowVertex(Vertex *vertex,
+                           VertexVisitor *visitor,
+                           BfsDataflow &dataflow,
+                           Level to_level,
+                           // Return value.
+                           VertexSeq &ready);
+
+  // Fanin counts kept between visitDataflow calls.
+  std::unique_ptr<BfsDataflow> dataflow_state_;
 };
 
 class BfsBkwdIterator : public BfsIterator
@@ -32,6 +32,8 @@
 
 #include "LibertyClass.hh"
 #include "Network.hh"
+#include "ObjectPool.hh"
+#include "StringPool.hh"
 #include "StringUtil.hh"
 
 namespace  sta {
@@ -46,11 +48,15 @@ class ConcreteTerm;
 class ConcretePort;
 class ConcreteBindingTbl;
 class ConcreteLibertyLibraryIterator;
+class ConcreteInstanceMemory;
 
 using ConcreteLibrarySeq = std::vector<ConcreteLibrary*>;
 using ConcreteLibraryMap = std::map<std::string, ConcreteLibrary*, std::less<>>;
-using ConcreteInstanceChildMap = std::map<std::string, ConcreteInstance*, std::less<>>;
-using ConcreteInstanceNetMap = std::map<std::string, ConcreteNet*, std::less<>>;
+// Map keys are the pooled instance/net names.
+using ConcreteInstanceChildMap = std::map<std::string_view, ConcreteInstance*,
+                                          std::less<>>;
+using ConcreteInstanceNetMap = std::map<std::string_view, ConcreteNet*,
+                                        std::less<>>;
 using ConcreteNetSeq = std::vector<ConcreteNet*>;
 using ConcretePinSeq = std::vector<ConcretePin*>;
 using CellNetworkViewMap = std::map<Cell*, Instance*>;
@@ -139,6 +145,10 @@ public:
   pinIterator(const Instance *instance) const override;
   InstanceNetIterator *
   netIterator(const Instance *instance) const override;
+  void visitChildren(const Instance *instance,
+                     NetworkInstanceVisitor &visitor) const override;
+  void visitPins(const Instance *instance,
+                 NetworkPinVisitor &visitor) const override;
 
   ObjectId id(const Pin *pin) const override;
   Instance *instance(const Pin *pin) const override;
@@ -166,6 +176,10 @@ public:
   bool isGround(const Net *net) const override;
   NetPinIterator *pinIterator(const Net *net) const override;
   NetTermIterator *termIterator(const Net *net) const override;
+  void visitPins(const Net *net,
+                 NetworkNetPinVisitor &visitor) const override;
+  void visitTerms(const Net *net,
+                  NetworkTermVisitor &visitor) const override;
   void mergeInto(Net *net,
                  Net *into_net) override;
   Net *mergedInto(Net *net) override;
@@ -248,12 +262,18 @@ public:
   void readNetlistBefore() override;
   void setLinkFunc(LinkNetworkFunc link) override;
   static ObjectId nextObjectId();
+  // Report the memory used by instances, nets, pins, terminals
+  // and names.
+  void reportMemory() const override;
 
   // Used by external tools.
   void setTopInstance(Instance *top_inst);
   void deleteTopInstance();
 
   using Network::netIterator;
+  using Network::visitChildren;
+  using Network::visitPins;
+  using Network::visitTerms;
   using Network::findPin;
   using Network::findNet;
   using Network::findNetsMatching;
@@ -279,6 +299,8 @@ protected:
                         ConcretePin *cpin);
   void connectNetPin(ConcreteNet *cnet,
                      ConcretePin *cpin);
+  void findInstanceMemory(const ConcreteInstance *inst,
+                          ConcreteInstanceMemory &memory) const;
 
   // Cell lookup search order sequence.
   ConcreteLibrarySeq library_seq_;
@@ -287,6 +309,12 @@ protected:
   NetSet constant_nets_[2]{NetSet(this), NetSet(this)};  // LogicValue::zero/one
   LinkNetworkFunc link_func_;
   CellNetworkViewMap cell_network_view_map_;
+  // Instance and net names.
+  StringPool name_pool_;
+  ObjectPool<ConcreteInstance> instance_pool_;
+  ObjectPool<ConcreteNet> net_pool_;
+  ObjectPool<ConcretePin> pin_pool_;
+  ObjectPool<ConcreteTerm> term_pool_;
   static ObjectId object_id_;
 
 private:
@@ -296,7 +324,7 @@ private:
 class ConcreteInstance
 {
 public:
-  const std::string &name() const { return name_; }
+  std::string_view name() const { return StringPool::view(name_); }
   ObjectId id() const { return id_; }
   Cell *cell() const;
   ConcreteInstance *parent() const { return parent_; }
@@ -311,7 +339,7 @@ public:
   void setAttribute(std::string_view key,
                     std::string_view value);
   std::string getAttribute(std::string_view key) const;
-  const AttributeMap &attributeMap() const { return attribute_map_; }
+  const AttributeMap &attributeMap() const;
   void addChild(ConcreteInstance *child);
   void deleteChild(ConcreteInstance *child);
   void addPin(ConcretePin *pin);
@@ -324,24 +352,27 @@ public:
   void initPins();
 
 protected:
-  ConcreteInstance(std::string_view name,
+  // name is owned by the network name pool.
+  ConcreteInstance(const char *name,
                    ConcreteCell *cell,
                    ConcreteInstance *parent);
   ~ConcreteInstance();
 
-  std::string name_;
-  ObjectId id_;
+  const char *name_;
   ConcreteCell *cell_;
   ConcreteInstance *parent_;
   // Array of pins indexed by pin->port->index().
   ConcretePinSeq pins_;
+  // Children, nets and attributes are allocated when they are added.
   ConcreteInstanceChildMap *children_{nullptr};
   ConcreteInstanceNetMap *nets_{nullptr};
-  AttributeMap attribute_map_;
+  AttributeMap *attribute_map_{nullptr};
+  ObjectId id_;
 
 private:
   friend class ConcreteNetwork;
   friend class ConcreteInstancePinIterator;
+  friend class ObjectPool<ConcreteInstance>;
 };
 
 class ConcretePin
@@ -376,6 +407,7 @@ private:
   friend class ConcreteNetwork;
   friend class ConcreteNet;
   friend class ConcreteNetPinIterator;
+  friend class ObjectPool<ConcretePin>;
 };
 
 class ConcreteTerm
@@ -401,12 +433,13 @@ private:
   friend class ConcreteNetwork;
   friend class ConcreteNet;
   friend class ConcreteNetTermIterator;
+  friend class ObjectPool<ConcreteTerm>;
 };
 
 class ConcreteNet
 {
 public:
-  const std::string &name() const { return name_; }
+  std::string_view name() const { return StringPool::view(name_); }
   ObjectId id() const { return id_; }
   ConcreteInstance *instance() const { return instance_; }
   void addPin(ConcretePin *pin);
@@ -417,10 +450,12 @@ public:
   ConcreteNet *mergedInto() { return merged_into_; }
 
 protected:
-  ConcreteNet(std::string_view name,
+  // name is owned by the network name pool.
+  ConcreteNet(const char *name,
               ConcreteInstance *instance);
-  std::string name_;
-  ObjectId id_;
+  ~ConcreteNet() = default;
+
+  const char *name_;
   ConcreteInstance *instance_;
   // Pointer to head of linked list of pins.
   ConcretePin *pins_{nullptr};
@@ -429,10 +464,12 @@ protected:
   // contains this net in the hierarchy level above.
   ConcreteTerm *terms_{nullptr};
   ConcreteNet *merged_into_{nullptr};
+  ObjectId id_;
 
   friend class ConcreteNetwork;
   friend class ConcreteNetTermIterator;
   friend class ConcreteNetPinIterator;
+  friend class ObjectPool<ConcreteNet>;
 };
 
 } // namespace sta
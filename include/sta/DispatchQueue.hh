@@ -67,6 +67,11 @@ class DispatchQueue
   using fp_t = std::function<void(int thread)>;
 
 public:
+  // Called with the task index and a [begin, end) index range.
+  using RangeFn = std::function<void(size_t task,
+                                     size_t begin,
+                                     size_t end)>;
+
   DispatchQueue(size_t thread_count);
   ~DispatchQueue();
   void setThreadCount(size_t thread_count);
@@ -76,6 +81,20 @@ public:
   // Dispatch and move.
   void dispatch(fp_t&& op);
   void finishTasks();
+  // Apply op to the index range [0, count) using task_count tasks and
+  // wait for them to finish.
+  // Each task starts on its own contiguous slice of the range and claims
+  // grain_size chunks from the front of it. Tasks that run out of work
+  // steal chunks from the slices of the other tasks so that uneven
+  // per-index costs do not leave threads idle.
+  // The task index passed to op is stable for the duration of a task,
+  // so per-task state (visitors, heaps) can be indexed by it.
+  // The calling thread runs tasks too, so op may call parallelFor.
+  // Returns the number of chunks that were stolen.
+  size_t parallelFor(size_t count,
+                     size_t task_count,
+                     size_t grain_size,
+                     const RangeFn &op);
 
   // Deleted operations
   DispatchQueue(const DispatchQueue& rhs) = delete;
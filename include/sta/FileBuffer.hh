@@ -0,0 +1,99 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace sta {
+
+// The contents of a file held in memory so readers can hand out string
+// views instead of copying tokens out of a stream.
+// Plain files are memory mapped where the platform supports it.
+// Gzip compressed files are not read; use a CompressedFileWindow to
+// scan them.
+class FileBuffer
+{
+public:
+  FileBuffer() = default;
+  ~FileBuffer();
+  FileBuffer(const FileBuffer &) = delete;
+  FileBuffer &operator=(const FileBuffer &) = delete;
+  // Return false if the file cannot be opened.
+  bool read(std::string_view filename);
+  void clear();
+  std::string_view contents() const;
+  size_t size() const { return contents().size(); }
+  bool isCompressed() const { return compressed_; }
+  bool isMapped() const { return mapped_ != nullptr; }
+
+private:
+  bool readMapped(const std::string &filename);
+  bool readStream(const std::string &filename);
+
+  // Memory mapped file contents.
+  char *mapped_{nullptr};
+  size_t mapped_size_{0};
+  // Copied file contents.
+  std::string data_;
+  bool compressed_{false};
+};
+
+// A window of lines from a gzip compressed file that is inflated as it
+// is scanned, so the whole file is never held in memory.
+class CompressedFileWindow
+{
+public:
+  CompressedFileWindow() = default;
+  ~CompressedFileWindow();
+  CompressedFileWindow(const CompressedFileWindow &) = delete;
+  CompressedFileWindow &operator=(const CompressedFileWindow &) = delete;
+  // False if zlib is not available to read compressed files.
+  static bool isSupported();
+  // Return false if the file cannot be opened.
+  bool open(std::string_view filename);
+  // Keep the text of the window from keep on and inflate more of the
+  // file after it. keep is nullptr or points into the last window.
+  // The window ends with a complete line unless it is the end of
+  // the file, so it is no longer than the kept text at the end of
+  // the file.
+  std::string_view refill(const char *keep);
+  // True if the file could not be inflated.
+  bool readError() const { return read_error_; }
+
+private:
+  // gzFile
+  void *file_{nullptr};
+  std::string buffer_;
+  // Inflated bytes in buffer_.
+  size_t size_{0};
+  // End of the last window.
+  size_t window_end_{0};
+  bool eof_{false};
+  bool read_error_{false};
+};
+
+} // namespace sta
@@ -25,9 +25,11 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <map>
 #include <mutex>
 
+#include "ArrayArena.hh"
 #include "Delay.hh"
 #include "GraphClass.hh"
 #include "Iterator.hh"
@@ -54,6 +56,38 @@ static constexpr EdgeId edge_id_null = object_id_null;
 static constexpr ObjectIdx edge_idx_null = object_id_null;
 static constexpr ObjectIdx vertex_idx_null = object_idx_null;
 
+// Index of a vertex's edges in the Graph adjacency edge arrays.
+class VertexAdjacency
+{
+public:
+  uint32_t out_begin;
+  uint32_t out_end;
+  uint32_t in_begin;
+  uint32_t in_end;
+};
+
+// Library timing arc edge found for an instance before it is made.
+class InstanceEdge
+{
+public:
+  Vertex *from;
+  Vertex *to;
+  TimingArcSet *arc_set;
+  bool is_check;
+  bool is_bidirect_inst_path;
+};
+
+// Loads of a driver pin on a net with one driver.
+class DrvrLoads
+{
+public:
+  const Pin *drvr;
+  PinSeq loads;
+};
+
+using InstanceEdgeSeq = std::vector<InstanceEdge>;
+using DrvrLoadsSeq = std::vector<DrvrLoads>;
+
 // The graph acts as a BUILDER for the graph vertices and edges.
 class Graph : public StaState
 {
@@ -61,10 +95,22 @@ public:
   Graph(StaState *sta,
         DcalcAPIndex ap_count);
   void makeGraph();
+  // Make the graph with the vertices numbered in the order of pins so
+  // that vertices visited together share table blocks. Edges are made
+  // in the order of their from pins. pins must include every pin that
+  // makeGraph() makes a vertex for.
+  void makeGraph(const PinSeq &pins);
   ~Graph() override;
 
   void delayCountChanged();
   size_t slewCount();
+  // Repack the slews and arc delays in level order if more than half
+  // of the delay storage is unused after vertices and edges are deleted.
+  void compactDelays();
+  // Number of floats stored for each slew and arc delay.
+  // Scalar analysis only stores the mean. POCV stores all of the
+  // Delay moments.
+  size_t delayFloatCount() const { return delay_float_count_; }
 
   // Vertex functions.
   // Bidirect pins have two vertices.
@@ -86,6 +132,20 @@ public:
   void deleteVertex(Vertex *vertex);
   bool hasFaninOne(Vertex *vertex) const;
   VertexId vertexCount() { return vertices_->size(); }
+  // Upper bound on vertex IDs for arrays indexed by VertexId.
+  VertexId vertexIdBound() const { return vertices_->idBound(); }
+
+  // The vertex edge iterators use contiguous copies of the vertex
+  // in/out edge lists ordered by vertex level when they are available.
+  // Vertices with edges made or deleted since the copy was made fall
+  // back to the edge lists. Only call these when no other threads are
+  // iterating over edges.
+  void makeAdjacency();
+  // Vertices sorted by level.
+  VertexSeq levelSortedVertices();
+  // Remake the edge arrays if they are missing or too many vertices
+  // have changed.
+  void ensureAdjacency();
 
   void visitFanouts(Vertex *vertex,
                     SearchPred *pred,
@@ -189,6 +249,15 @@ public:
 
   // Remove all delay and slew annotations.
   void removeDelaySlewAnnotations();
+  // Save the delay, slew and period check annotations so they can be
+  // restored to a graph rebuilt for the same network.
+  void saveAnnotations(GraphAnnotations &annotations);
+  void restoreAnnotations(GraphAnnotations &annotations);
+  // Set the sim flags for a mode. Modes propagate constants concurrently,
+  // so the flags are atomic and not bit fields.
+  void setHasSimValue(Vertex *vertex);
+  void setHasSimSense(Edge *edge);
+  void setHasDisabledCond(Edge *edge);
   VertexSet &regClkVertices() { return reg_clk_vertices_; }
 
   static constexpr int vertex_level_bits = 24;
@@ -196,6 +265,11 @@ public:
 
 protected:
   void makeVerticesAndEdges();
+  void makeVerticesAndEdgesParallel();
+  void makeWireEdgesParallel();
+  size_t nextLeafInstances(LeafInstanceIterator *inst_iter,
+                           // Return value.
+                           InstanceSeq &insts) const;
   Vertex *makeVertex(Pin *pin,
                      bool is_bidirect_drvr,
                      bool is_reg_clk);
@@ -211,6 +285,18 @@ protected:
   void makePortInstanceEdges(const Instance *inst,
                              LibertyCell *cell,
                              LibertyPort *from_to_port);
+  void findPortInstanceEdges(const Instance *inst,
+                             LibertyCell *cell,
+                             LibertyPort *from_to_port,
+                             // Return value.
+                             InstanceEdgeSeq &edges) const;
+  void makeInstanceEdges(const InstanceEdgeSeq &edges);
+  void findSingleDrvrLoads(const Instance *inst,
+                           // Return value.
+                           DrvrLoadsSeq &drvr_loads) const;
+  void makeInstDrvrWireEdges(const Instance *inst,
+                             const DrvrLoadsSeq &drvr_loads,
+                             PinSet &visited_drvrs);
   void removePeriodCheckAnnotations();
   void makeVertexSlews(Vertex *vertex);
   void deleteInEdge(Vertex *vertex,
@@ -220,7 +306,17 @@ protected:
   void initSlews();
   void initSlews(Vertex *vertex);
   void initArcDelays(Edge *edge);
+  size_t arcDelayFloatCount(const Edge *edge) const;
+  void deleteArcDelays(Edge *edge);
+  void findDelayFloatCount();
+  Delay storedDelay(const float *delays,
+                    size_t index) const;
+  void setStoredDelay(float *delays,
+                      size_t index,
+                      const Delay &delay);
   void removeDelayAnnotated(Edge *edge);
+  const VertexAdjacency *adjacency(const Vertex *vertex) const;
+  void adjacencyChanged(const Vertex *vertex);
 
   VertexTable *vertices_{nullptr};
   EdgeTable *edges_{nullptr};
@@ -234,6 +330,25 @@ protected:
   // Register/latch clock vertices to search from.
   VertexSet reg_clk_vertices_;
   DcalcAPIndex ap_count_;
+  // Floats per slew/arc delay in Vertex::slews_ and Edge::arc_delays_.
+  // Fixed when the delay arrays are allocated so that the layout does not
+  // change underneath them if the pocv mode changes.
+  size_t delay_float_count_;
+  // Vertex::slews_ and Edge::arc_delays_ arrays.
+  ArrayArena<float> delay_arena_;
+  // Edge arrays indexed by VertexId used by the vertex edge iterators.
+  std::vector<VertexAdjacency> adjacency_;
+  EdgeIdSeq adjacency_out_edges_;
+  EdgeIdSeq adjacency_in_edges_;
+  // Vertices that use the edge lists instead of the edge arrays.
+  size_t adjacency_changed_count_{0};
+
+  // Remake the edge arrays when more than 1/N of the vertices changed.
+  static constexpr size_t adjacency_remake_ratio_ = 8;
+  static constexpr uint32_t adjacency_changed_ = UINT32_MAX;
+  // Instances per batch found in parallel by makeGraph.
+  static constexpr size_t make_graph_batch_size_ = 1 << 16;
+  static constexpr size_t make_graph_grain_size_ = 256;
 
   friend class DbGraphReader;
   friend class DbGraphWriter;
@@ -267,8 +382,8 @@ public:
   [[nodiscard]] bool isRoot() const{ return level_ == 0; }
   [[nodiscard]] bool hasFanin() const;
   [[nodiscard]] bool hasFanout() const;
+  // Path arrays are allocated by Search.
   Path *paths() const { return paths_; }
-  Path *makePaths(uint32_t count);
   void setPaths(Path *paths);
   void deletePaths();
   TagGroupIndex tagGroupIndex() const;
@@ -291,7 +406,8 @@ public:
   void setHasDownstreamClkPin(bool has_clk_pin);
   [[nodiscard]] bool isRegClk() const { return is_reg_clk_; }
   // Has sim value in some mode.
-  [[nodiscard]] bool hasSimValue() const { return has_sim_value_; }
+  [[nodiscard]] bool hasSimValue() const
+  { return has_sim_value_.load(std::memory_order_relaxed); }
   void setHasSimValue(bool has_sim);
   
   [[nodiscard]] bool bfsInQueue(BfsIndex index) const;
@@ -308,8 +424,6 @@ protected:
             bool is_bidirect_drvr,
             bool is_reg_clk);
   void clear();
-  Slew *slews() { return reinterpret_cast<Slew*>(slews_); }
-  const Slew *slews() const { return reinterpret_cast<const Slew*>(slews_); }
   float *slewsFloat() { return slews_; }
   const float *slewsFloat() const { return slews_; }
   void setSlews(float *slews);
@@ -329,6 +443,8 @@ protected:
   uint32_t object_idx_;
   // Each bit corresponds to a different BFS queue.
   std::atomic<uint8_t> bfs_in_queue_; // 8
+  // Set by concurrent mode constant propagation.
+  std::atomic<bool> has_sim_value_;
 
   // Bidirect pins have two vertices.
   // This flag distinguishes the driver and load vertices.
@@ -342,7 +458,6 @@ protected:
   unsigned int visited1_:1;
   unsigned int visited2_:1;
   unsigned int bfs_predecessor_changed_:1;
-  unsigned int has_sim_value_:1;
   int level_:Graph::vertex_level_bits; // 24
   unsigned int slew_annotated_:slew_annotated_bits;  // 4
 
@@ -387,9 +502,11 @@ public:
   void setIsBidirectPortPath(bool is_bidir);
 
   void removeDelayAnnotated();
-  [[nodiscard]] bool hasSimSense() const { return has_sim_sense_; }
+  [[nodiscard]] bool hasSimSense() const
+  { return has_sim_sense_.load(std::memory_order_relaxed); }
   void setHasSimSense(bool has_sense);
-  [[nodiscard]] bool hasDisabledCond() const { return has_disabled_cond_; }
+  [[nodiscard]] bool hasDisabledCond() const
+  { return has_disabled_cond_.load(std::memory_order_relaxed); }
   void setHasDisabledCond(bool has_disabled);
 
   // ObjectTable interface.
@@ -421,6 +538,9 @@ protected:
   EdgeId vertex_in_next_;               // Vertex in edges list.
   EdgeId vertex_out_next_;              // Vertex out edges doubly linked list.
   EdgeId vertex_out_prev_;
+  // Set by concurrent mode constant propagation.
+  std::atomic<bool> has_sim_sense_;
+  std::atomic<bool> has_disabled_cond_;
   bool arc_delay_annotated_is_bits_:1;
   bool delay_annotation_is_incremental_:1;
   bool is_bidirect_inst_path_:1;
@@ -428,8 +548,6 @@ protected:
   // Bidirect load -> driver edge.
   bool is_bidirect_port_path_:1;
   bool is_disabled_loop_:1;
-  bool has_sim_sense_:1;
-  bool has_disabled_cond_:1;
   unsigned object_idx_:VertexTable::idx_bits;
 
 private:
@@ -442,6 +560,48 @@ private:
   friend class VertexOutEdgeIterator;
 };
 
+// Annotations of a graph keyed by pins and timing arc sets.
+class GraphAnnotations
+{
+public:
+  ~GraphAnnotations();
+  [[nodiscard]] bool empty() const;
+
+private:
+  // Bidirect driver vertices have the same pin as the load vertex.
+  struct VertexKey
+  {
+    const Pin *pin;
+    bool is_bidirect_drvr;
+  };
+  struct VertexSlews
+  {
+    VertexKey vertex;
+    unsigned int slew_annotated;
+    SlewSeq slews;
+  };
+  struct ArcDelayAnnotation
+  {
+    const TimingArc *arc;
+    DcalcAPIndex ap_index;
+    ArcDelay delay;
+  };
+  struct EdgeDelays
+  {
+    VertexKey from;
+    VertexKey to;
+    const TimingArcSet *arc_set;
+    bool is_incremental;
+    std::vector<ArcDelayAnnotation> delays;
+  };
+
+  std::vector<VertexSlews> vertex_slews_;
+  std::vector<EdgeDelays> edge_delays_;
+  PeriodCheckAnnotations period_checks_{nullptr};
+
+  friend class Graph;
+};
+
 // Iterate over all graph vertices.
 class VertexIterator : public Iterator<Vertex*>
 {
@@ -474,7 +634,12 @@ public:
   Edge *next() override;
 
 private:
+  void init(const Vertex *vertex);
+
   Edge *next_;
+  // Edge array range when the graph adjacency is valid for the vertex.
+  const EdgeId *ids_{nullptr};
+  const EdgeId *ids_end_{nullptr};
   const Graph *graph_;
 };
 
@@ -488,6 +653,9 @@ public:
 
 private:
   Edge *next_;
+  // Edge array range when the graph adjacency is valid for the vertex.
+  const EdgeId *ids_{nullptr};
+  const EdgeId *ids_end_{nullptr};
   const Graph *graph_;
 };
 
@@ -42,6 +42,8 @@ class Edge;
 class VertexIterator;
 class VertexInEdgeIterator;
 class VertexOutEdgeIterator;
+class VertexAdjacency;
+class GraphAnnotations;
 
 class VertexIdLess
 {
@@ -61,6 +63,7 @@ using VertexSeq = std::vector<Vertex*>;
 using VertexSet = std::set<Vertex*, VertexIdLess>;
 using EdgeSeq = std::vector<Edge*>;
 using EdgeSet = std::set<Edge*>;
+using EdgeIdSeq = std::vector<EdgeId>;
 using Level = int;
 using DcalcAPIndex = int;
 using TagGroupIndex = int;
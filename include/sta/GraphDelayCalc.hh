@@ -190,6 +190,8 @@ protected:
   void findDriverDelays(Vertex *drvr_vertex,
 			ArcDelayCalc *arc_delay_calc,
                         LoadPinIndexMap &load_pin_index_map);
+  void releaseParasiticNetworks(const Pin *drvr_pin);
+  void reportParasiticReadMessages();
   MultiDrvrNet *multiDrvrNet(const Vertex *drvr_vertex) const;
   MultiDrvrNet *findMultiDrvrNet(Vertex *drvr_vertex);
   MultiDrvrNet *makeMultiDrvrNet(Vertex *drvr_vertex);
@@ -215,6 +217,16 @@ protected:
                            const MinMax *min_max,
                            ArcDelayCalc *arc_delay_calc,
                            LoadPinIndexMap &load_pin_index_map);
+  // Find the arc delays for all scenes and min/max in one call
+  // to the arc delay calculator.
+  bool findDriverArcDelaysAPs(Vertex *drvr_vertex,
+                              const MultiDrvrNet *multi_drvr,
+                              Edge *edge,
+                              const TimingArc *arc,
+                              ArcDelayCalc *arc_delay_calc,
+                              LoadPinIndexMap &load_pin_index_map,
+                              // Return value.
+                              std::array<bool, RiseFall::index_count> &delay_exists);
   ArcDcalcArgSeq makeArcDcalcArgs(Vertex *drvr_vertex,
                                   const MultiDrvrNet *multi_drvr,
                                   Edge *edge,
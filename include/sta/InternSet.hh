@@ -0,0 +1,527 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sta {
+
+// Open addressed hash table of object pointers for InternSet.
+template <class TYPE>
+class InternSlots
+{
+public:
+  InternSlots(size_t capacity) :
+    mask(capacity - 1),
+    slots(new std::atomic<TYPE*>[capacity])
+  {
+    for (size_t i = 0; i < capacity; i++)
+      slots[i].store(nullptr, std::memory_order_relaxed);
+  }
+  size_t capacity() const { return mask + 1; }
+
+  const size_t mask;
+  std::unique_ptr<std::atomic<TYPE*>[]> slots;
+};
+
+template <class TYPE>
+class alignas(64) InternShard
+{
+public:
+  std::mutex lock;
+  std::atomic<InternSlots<TYPE>*> slots{nullptr};
+  // Tables replaced by a larger one that readers may still be using.
+  std::vector<InternSlots<TYPE>*> retired;
+  std::atomic<size_t> count{0};
+  size_t erased_count{0};
+  std::atomic<size_t> lock_count{0};
+  std::atomic<size_t> contended_count{0};
+};
+
+// Set of unique objects (tags, clk infos) shared by search threads.
+// Lookups are lock free. Inserts lock one of shard_count shards
+// selected by the object hash so threads inserting different objects
+// rarely wait on each other. Tables that grow are retired rather than
+// deleted so lookups in other threads can keep using them until
+// deleteRetired() is called between searches.
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+class InternSet
+{
+public:
+  InternSet(size_t capacity,
+            const HASH &hash,
+            const EQUAL &equal);
+  ~InternSet();
+  // Lock free. Safe while other threads insert.
+  TYPE *find(const TYPE *probe) const;
+  // Find probe or insert make(). Make is called with the shard locked.
+  template <class MAKE>
+  TYPE *findOrInsert(const TYPE *probe,
+                     MAKE make);
+  size_t shardIndex(const TYPE *obj) const;
+  // Lock the shard of the objects to insert. Counts contention.
+  void lockShard(size_t shard_index);
+  void unlockShard(size_t shard_index);
+  // The shard for obj must be locked.
+  void insert(TYPE *obj);
+  // Not thread safe.
+  void erase(const TYPE *obj);
+  // Not thread safe.
+  void clear();
+  // Delete the objects and clear. Not thread safe.
+  void deleteContents();
+  // Delete tables replaced by growth. Not thread safe.
+  void deleteRetired();
+  // Not thread safe.
+  template <class FUNC>
+  void forEach(FUNC func) const;
+  size_t size() const;
+  // Times an insert locked a shard.
+  size_t lockCount() const;
+  // Times a shard lock was held by another thread.
+  size_t contendedCount() const;
+
+  static constexpr size_t shard_count = 64;
+
+private:
+  size_t mixHash(const TYPE *obj) const;
+  TYPE *find(const TYPE *probe,
+             size_t hash) const;
+  void grow(InternShard<TYPE> &shard,
+            InternSlots<TYPE> *slots);
+  static void insert(InternSlots<TYPE> *slots,
+                     size_t hash,
+                     TYPE *obj);
+  static TYPE *erased() { return reinterpret_cast<TYPE*>(uintptr_t(1)); }
+
+  HASH hash_;
+  EQUAL equal_;
+  size_t shard_capacity_;
+  std::unique_ptr<InternShard<TYPE>[]> shards_;
+};
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+InternSet<TYPE, HASH, EQUAL>::InternSet(size_t capacity,
+                                        const HASH &hash,
+                                        const EQUAL &equal) :
+  hash_(hash),
+  equal_(equal),
+  shard_capacity_(8),
+  shards_(new InternShard<TYPE>[shard_count])
+{
+  // Keep the tables at most half full.
+  while (shard_capacity_ * shard_count < capacity * 2)
+    shard_capacity_ *= 2;
+  for (size_t i = 0; i < shard_count; i++)
+    shards_[i].slots.store(new InternSlots<TYPE>(shard_capacity_),
+                           std::memory_order_relaxed);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+InternSet<TYPE, HASH, EQUAL>::~InternSet()
+{
+  deleteRetired();
+  for (size_t i = 0; i < shard_count; i++)
+    delete shards_[i].slots.load(std::memory_order_relaxed);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+size_t
+InternSet<TYPE, HASH, EQUAL>::mixHash(const TYPE *obj) const
+{
+  // Spread the object hash so the high bits select the shard and
+  // the low bits the slot.
+  uint64_t hash = static_cast<uint64_t>(hash_(obj)) * 0x9e3779b97f4a7c15ull;
+  return hash ^ (hash >> 32);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+size_t
+InternSet<TYPE, HASH, EQUAL>::shardIndex(const TYPE *obj) const
+{
+  return (mixHash(obj) >> 26) % shard_count;
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+TYPE *
+InternSet<TYPE, HASH, EQUAL>::find(const TYPE *probe) const
+{
+  return find(probe, mixHash(probe));
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+TYPE *
+InternSet<TYPE, HASH, EQUAL>::find(const TYPE *probe,
+                                   size_t hash) const
+{
+  const InternShard<TYPE> &shard = shards_[(hash >> 26) % shard_count];
+  const InternSlots<TYPE> *slots = shard.slots.load(std::memory_order_acquire);
+  for (size_t i = hash & slots->mask; ; i = (i + 1) & slots->mask) {
+    TYPE *obj = slots->slots[i].load(std::memory_order_acquire);
+    if (obj == nullptr)
+      return nullptr;
+    if (obj != erased() && equal_(obj, probe))
+      return obj;
+  }
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+template <class MAKE>
+TYPE *
+InternSet<TYPE, HASH, EQUAL>::findOrInsert(const TYPE *probe,
+                                           MAKE make)
+{
+  size_t hash = mixHash(probe);
+  TYPE *obj = find(probe, hash);
+  if (obj == nullptr) {
+    size_t shard_index = (hash >> 26) % shard_count;
+    lockShard(shard_index);
+    // Another thread may have inserted it after the lock free find.
+    obj = find(probe, hash);
+    if (obj == nullptr) {
+      obj = make();
+      insert(obj);
+    }
+    unlockShard(shard_index);
+  }
+  return obj;
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::lockShard(size_t shard_index)
+{
+  InternShard<TYPE> &shard = shards_[shard_index];
+  if (!shard.lock.try_lock()) {
+    shard.contended_count.fetch_add(1, std::memory_order_relaxed);
+    shard.lock.lock();
+  }
+  shard.lock_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::unlockShard(size_t shard_index)
+{
+  shards_[shard_index].lock.unlock();
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::insert(TYPE *obj)
+{
+  size_t hash = mixHash(obj);
+  InternShard<TYPE> &shard = shards_[(hash >> 26) % shard_count];
+  InternSlots<TYPE> *slots = shard.slots.load(std::memory_order_relaxed);
+  size_t count = shard.count.load(std::memory_order_relaxed);
+  if ((count + shard.erased_count + 1) * 2 > slots->capacity()) {
+    grow(shard, slots);
+    slots = shard.slots.load(std::memory_order_relaxed);
+  }
+  insert(slots, hash, obj);
+  shard.count.store(count + 1, std::memory_order_relaxed);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::insert(InternSlots<TYPE> *slots,
+                                     size_t hash,
+                                     TYPE *obj)
+{
+  size_t i = hash & slots->mask;
+  while (slots->slots[i].load(std::memory_order_relaxed) != nullptr)
+    i = (i + 1) & slots->mask;
+  // Release so lookups see the object contents.
+  slots->slots[i].store(obj, std::memory_order_release);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::grow(InternShard<TYPE> &shard,
+                                   InternSlots<TYPE> *slots)
+{
+  size_t count = shard.count.load(std::memory_order_relaxed);
+  size_t capacity = slots->capacity();
+  // Erased slots are dropped so the table may not need to grow.
+  while ((count + 1) * 2 > capacity)
+    capacity *= 2;
+  InternSlots<TYPE> *slots2 = new InternSlots<TYPE>(capacity);
+  for (size_t i = 0; i < slots->capacity(); i++) {
+    TYPE *obj = slots->slots[i].load(std::memory_order_relaxed);
+    if (obj && obj != erased())
+      insert(slots2, mixHash(obj), obj);
+  }
+  shard.erased_count = 0;
+  shard.slots.store(slots2, std::memory_order_release);
+  shard.retired.push_back(slots);
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::erase(const TYPE *obj)
+{
+  size_t hash = mixHash(obj);
+  InternShard<TYPE> &shard = shards_[(hash >> 26) % shard_count];
+  InternSlots<TYPE> *slots = shard.slots.load(std::memory_order_relaxed);
+  for (size_t i = hash & slots->mask; ; i = (i + 1) & slots->mask) {
+    TYPE *obj1 = slots->slots[i].load(std::memory_order_relaxed);
+    if (obj1 == nullptr)
+      break;
+    if (obj1 == obj) {
+      // Leave a marker so lookups continue past the slot.
+      slots->slots[i].store(erased(), std::memory_order_relaxed);
+      shard.count.fetch_sub(1, std::memory_order_relaxed);
+      shard.erased_count++;
+      break;
+    }
+  }
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::clear()
+{
+  deleteRetired();
+  for (size_t i = 0; i < shard_count; i++) {
+    InternShard<TYPE> &shard = shards_[i];
+    InternSlots<TYPE> *slots = shard.slots.load(std::memory_order_relaxed);
+    if (slots->capacity() != shard_capacity_) {
+      delete slots;
+      shard.slots.store(new InternSlots<TYPE>(shard_capacity_),
+                        std::memory_order_relaxed);
+    }
+    else {
+      for (size_t j = 0; j < slots->capacity(); j++)
+        slots->slots[j].store(nullptr, std::memory_order_relaxed);
+    }
+    shard.count.store(0, std::memory_order_relaxed);
+    shard.erased_count = 0;
+  }
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::deleteContents()
+{
+  forEach([](TYPE *obj) { delete obj; });
+  clear();
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+void
+InternSet<TYPE, HASH, EQUAL>::deleteRetired()
+{
+  for (size_t i = 0; i < shard_count; i++) {
+    InternShard<TYPE> &shard = shards_[i];
+    for (InternSlots<TYPE> *slots : shard.retired)
+      delete slots;
+    shard.retired.clear();
+  }
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+template <class FUNC>
+void
+InternSet<TYPE, HASH, EQUAL>::forEach(FUNC func) const
+{
+  for (size_t i = 0; i < shard_count; i++) {
+    const InternSlots<TYPE> *slots = shards_[i].slots.load(std::memory_order_relaxed);
+    for (size_t j = 0; j < slots->capacity(); j++) {
+      TYPE *obj = slots->slots[j].load(std::memory_order_relaxed);
+      if (obj && obj != erased())
+        func(obj);
+    }
+  }
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+size_t
+InternSet<TYPE, HASH, EQUAL>::size() const
+{
+  size_t size = 0;
+  for (size_t i = 0; i < shard_count; i++)
+    size += shards_[i].count.load(std::memory_order_relaxed);
+  return size;
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+size_t
+InternSet<TYPE, HASH, EQUAL>::lockCount() const
+{
+  size_t count = 0;
+  for (size_t i = 0; i < shard_count; i++)
+    count += shards_[i].lock_count.load(std::memory_order_relaxed);
+  return count;
+}
+
+template <class TYPE,
+          class HASH,
+          class EQUAL>
+size_t
+InternSet<TYPE, HASH, EQUAL>::contendedCount() const
+{
+  size_t count = 0;
+  for (size_t i = 0; i < shard_count; i++)
+    count += shards_[i].contended_count.load(std::memory_order_relaxed);
+  return count;
+}
+
+////////////////////////////////////////////////////////////////
+
+// Table of objects indexed by a stable index (TagIndex, TagGroupIndex).
+// The table is a directory of fixed size blocks so growing it never
+// moves entries and lookups in other threads stay valid without a lock.
+// Blocks are allocated on first use with a compare and swap.
+template <class TYPE,
+          size_t BLOCK_BITS = 12>
+class InternIndexTable
+{
+public:
+  InternIndexTable(size_t index_max);
+  ~InternIndexTable();
+  // Lock free. Null if index has not been set.
+  TYPE *operator[](size_t index) const;
+  // Thread safe for different indices.
+  void set(size_t index,
+           TYPE *obj);
+  // Not thread safe.
+  void clear();
+
+private:
+  static constexpr size_t block_size_ = size_t(1) << BLOCK_BITS;
+
+  size_t block_count_;
+  std::unique_ptr<std::atomic<std::atomic<TYPE*>*>[]> blocks_;
+};
+
+template <class TYPE,
+          size_t BLOCK_BITS>
+InternIndexTable<TYPE, BLOCK_BITS>::InternIndexTable(size_t index_max) :
+  block_count_((index_max >> BLOCK_BITS) + 1),
+  blocks_(new std::atomic<std::atomic<TYPE*>*>[block_count_])
+{
+  for (size_t i = 0; i < block_count_; i++)
+    blocks_[i].store(nullptr, std::memory_order_relaxed);
+}
+
+template <class TYPE,
+          size_t BLOCK_BITS>
+InternIndexTable<TYPE, BLOCK_BITS>::~InternIndexTable()
+{
+  clear();
+}
+
+template <class TYPE,
+          size_t BLOCK_BITS>
+TYPE *
+InternIndexTable<TYPE, BLOCK_BITS>::operator[](size_t index) const
+{
+  std::atomic<TYPE*> *block =
+    blocks_[index >> BLOCK_BITS].load(std::memory_order_acquire);
+  if (block)
+    return block[index & (block_size_ - 1)].load(std::memory_order_acquire);
+  else
+    return nullptr;
+}
+
+template <class TYPE,
+          size_t BLOCK_BITS>
+void
+InternIndexTable<TYPE, BLOCK_BITS>::set(size_t index,
+                                        TYPE *obj)
+{
+  std::atomic<std::atomic<TYPE*>*> &block_ref = blocks_[index >> BLOCK_BITS];
+  std::atomic<TYPE*> *block = block_ref.load(std::memory_order_acquire);
+  if (block == nullptr) {
+    std::atomic<TYPE*> *block1 = new std::atomic<TYPE*>[block_size_];
+    for (size_t i = 0; i < block_size_; i++)
+      block1[i].store(nullptr, std::memory_order_relaxed);
+    if (block_ref.compare_exchange_strong(block, block1,
+                                          std::memory_order_acq_rel))
+      block = block1;
+    else
+      // Another thread allocated the block first.
+      delete[] block1;
+  }
+  block[index & (block_size_ - 1)].store(obj, std::memory_order_release);
+}
+
+template <class TYPE,
+          size_t BLOCK_BITS>
+void
+InternIndexTable<TYPE, BLOCK_BITS>::clear()
+{
+  for (size_t i = 0; i < block_count_; i++) {
+    delete[] blocks_[i].load(std::memory_order_relaxed);
+    blocks_[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+} // namespace sta
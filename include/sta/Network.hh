@@ -24,10 +24,15 @@
 
 #pragma once
 
+#include <array>
+#include <concepts>
 #include <functional>
 #include <map>
+#include <shared_mutex>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #include "LibertyClass.hh"
 #include "NetworkClass.hh"
@@ -40,6 +45,12 @@ namespace sta {
 class Report;
 class PatternMatch;
 class PinVisitor;
+template <typename Obj> class NetworkVisitor;
+
+using NetworkInstanceVisitor = NetworkVisitor<Instance*>;
+using NetworkPinVisitor = NetworkVisitor<Pin*>;
+using NetworkNetPinVisitor = NetworkVisitor<const Pin*>;
+using NetworkTermVisitor = NetworkVisitor<Term*>;
 
 using LibertyLibraryMap = std::map<std::string, LibertyLibrary*, std::less<>>;
 // Link network function returns top level instance.
@@ -107,6 +118,8 @@ public:
                            Report *report) = 0;
   virtual bool isLinked() const;
   virtual bool isEditable() const { return false; }
+  // Report the memory used to store the network.
+  virtual void reportMemory() const;
 
   ////////////////////////////////////////////////////////////////
   // Library functions.
@@ -264,6 +277,20 @@ public:
   // instance parent thru pins.
   virtual InstanceNetIterator *
   netIterator(const Instance *instance) const = 0;
+  // Visit the children and pins of an instance without allocating an
+  // iterator. fn is called with each Instance*/Pin*.
+  // The network must not be edited while visiting.
+  template <typename Fn> requires std::invocable<Fn&, Instance*>
+  void visitChildren(const Instance *instance,
+                     Fn &&fn) const;
+  template <typename Fn> requires std::invocable<Fn&, Pin*>
+  void visitPins(const Instance *instance,
+                 Fn &&fn) const;
+  // Default implementations use childIterator/pinIterator.
+  virtual void visitChildren(const Instance *instance,
+                             NetworkInstanceVisitor &visitor) const;
+  virtual void visitPins(const Instance *instance,
+                         NetworkPinVisitor &visitor) const;
   int instanceCount();
   int instanceCount(Instance *inst);
   int leafInstanceCount();
@@ -415,6 +442,20 @@ public:
   virtual NetPinIterator *pinIterator(const Net *net) const = 0;
   // Iterate over the terminals connected to a net.
   virtual NetTermIterator *termIterator(const Net *net) const = 0;
+  // Visit the pins and terminals of a net without allocating an
+  // iterator. fn is called with each const Pin*/Term*.
+  // The network must not be edited while visiting.
+  template <typename Fn> requires std::invocable<Fn&, const Pin*>
+  void visitPins(const Net *net,
+                 Fn &&fn) const;
+  template <typename Fn> requires std::invocable<Fn&, Term*>
+  void visitTerms(const Net *net,
+                  Fn &&fn) const;
+  // Default implementations use pinIterator/termIterator.
+  virtual void visitPins(const Net *net,
+                         NetworkNetPinVisitor &visitor) const;
+  virtual void visitTerms(const Net *net,
+                          NetworkTermVisitor &visitor) const;
   // Iterate over all of the pins connected to a net and the parent
   // and child nets it is hierarchically connected to (port, leaf and
   // hierarchical pins).
@@ -508,6 +549,9 @@ protected:
   char divider_{'/'};
   char escape_{'\\'};
   NetDrvrPinsMap net_drvr_pin_map_;
+  // drivers(net) fills the map on demand from multiple threads.
+  // Lookups share the lock; inserts and edits take it exclusively.
+  std::shared_mutex net_drvr_pin_map_lock_;
 
   // Map of generated clock pins to their corresponding liberty cell
   std::map<std::string, LibertyCell*> generated_clock_pins_to_cells_;
@@ -657,6 +701,98 @@ public:
   virtual void operator()(const Pin *pin) = 0;
 };
 
+// Abstract base class for the Network::visitChildren, visitPins and
+// visitTerms visitors. Objects are visited in batches so there is one
+// virtual call per batch rather than one per object.
+template <typename Obj>
+class NetworkVisitor
+{
+public:
+  virtual ~NetworkVisitor() = default;
+  virtual void visit(std::span<const Obj> objs) = 0;
+};
+
+// Adapt a callable to a network visitor.
+// The callable is referenced, not copied.
+template <typename Obj,
+          typename Fn>
+class NetworkVisitorFn final : public NetworkVisitor<Obj>
+{
+public:
+  NetworkVisitorFn(Fn &fn) : fn_(fn) {}
+  void visit(std::span<const Obj> objs) override
+  {
+    for (Obj obj : objs)
+      fn_(obj);
+  }
+
+private:
+  Fn &fn_;
+};
+
+// Collect objects into batches for a network visitor.
+// Call flush after the last object is added.
+template <typename Obj>
+class NetworkVisitorBatch
+{
+public:
+  NetworkVisitorBatch(NetworkVisitor<Obj> &visitor) : visitor_(visitor) {}
+  void add(Obj obj)
+  {
+    objs_[count_++] = obj;
+    if (count_ == objs_.size())
+      flush();
+  }
+  void flush()
+  {
+    if (count_ > 0) {
+      visitor_.visit(std::span<const Obj>(objs_.data(), count_));
+      count_ = 0;
+    }
+  }
+
+private:
+  NetworkVisitor<Obj> &visitor_;
+  std::array<Obj, 32> objs_;
+  size_t count_{0};
+};
+
+template <typename Fn> requires std::invocable<Fn&, Instance*>
+void
+Network::visitChildren(const Instance *instance,
+                       Fn &&fn) const
+{
+  NetworkVisitorFn<Instance*, std::remove_reference_t<Fn>> visitor(fn);
+  visitChildren(instance, visitor);
+}
+
+template <typename Fn> requires std::invocable<Fn&, Pin*>
+void
+Network::visitPins(const Instance *instance,
+                   Fn &&fn) const
+{
+  NetworkVisitorFn<Pin*, std::remove_reference_t<Fn>> visitor(fn);
+  visitPins(instance, visitor);
+}
+
+template <typename Fn> requires std::invocable<Fn&, const Pin*>
+void
+Network::visitPins(const Net *net,
+                   Fn &&fn) const
+{
+  NetworkVisitorFn<const Pin*, std::remove_reference_t<Fn>> visitor(fn);
+  visitPins(net, visitor);
+}
+
+template <typename Fn> requires std::invocable<Fn&, Term*>
+void
+Network::visitTerms(const Net *net,
+                    Fn &&fn) const
+{
+  NetworkVisitorFn<Term*, std::remove_reference_t<Fn>> visitor(fn);
+  visitTerms(net, visitor);
+}
+
 class FindNetDrvrLoads : public PinVisitor
 {
 public:
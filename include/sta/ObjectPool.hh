@@ -0,0 +1,122 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sta {
+
+template <class TYPE>
+union ObjectPoolSlot
+{
+  ObjectPoolSlot *next_free;
+  alignas(TYPE) std::byte object[sizeof(TYPE)];
+};
+
+// Allocates objects of TYPE from large blocks so that each object does
+// not need its own heap allocation. Destroyed objects are kept on a
+// free list and reused. Classes with protected constructors and
+// destructors must be friends of ObjectPool<TYPE>.
+// The pool must not be cleared or destroyed while it has objects that
+// have not been destroyed. Not thread safe.
+template <class TYPE,
+          size_t BLOCK_SIZE = 1024>
+class ObjectPool
+{
+public:
+  ObjectPool() = default;
+  template <class... ARGS>
+  TYPE *make(ARGS &&...args);
+  void destroy(TYPE *object);
+  // Free all of the blocks.
+  void clear();
+  // Objects in blocks, including unused ones.
+  size_t capacity() const { return blocks_.size() * BLOCK_SIZE; }
+  // Objects that have not been destroyed.
+  size_t size() const { return size_; }
+  size_t blockCount() const { return blocks_.size(); }
+
+private:
+  using Slot = ObjectPoolSlot<TYPE>;
+
+  std::vector<std::unique_ptr<Slot[]>> blocks_;
+  // Unused slots at the end of the last block.
+  size_t next_index_{BLOCK_SIZE};
+  Slot *free_{nullptr};
+  size_t size_{0};
+};
+
+template <class TYPE,
+          size_t BLOCK_SIZE>
+template <class... ARGS>
+TYPE *
+ObjectPool<TYPE, BLOCK_SIZE>::make(ARGS &&...args)
+{
+  Slot *slot;
+  if (free_) {
+    slot = free_;
+    free_ = slot->next_free;
+  }
+  else {
+    if (next_index_ == BLOCK_SIZE) {
+      blocks_.push_back(std::make_unique_for_overwrite<Slot[]>(BLOCK_SIZE));
+      next_index_ = 0;
+    }
+    slot = &blocks_.back()[next_index_++];
+  }
+  size_++;
+  return new (slot->object) TYPE(std::forward<ARGS>(args)...);
+}
+
+template <class TYPE,
+          size_t BLOCK_SIZE>
+void
+ObjectPool<TYPE, BLOCK_SIZE>::destroy(TYPE *object)
+{
+  if (object) {
+    object->~TYPE();
+    Slot *slot = reinterpret_cast<Slot*>(object);
+    slot->next_free = free_;
+    free_ = slot;
+    size_--;
+  }
+}
+
+template <class TYPE,
+          size_t BLOCK_SIZE>
+void
+ObjectPool<TYPE, BLOCK_SIZE>::clear()
+{
+  blocks_.clear();
+  next_index_ = BLOCK_SIZE;
+  free_ = nullptr;
+  size_ = 0;
+}
+
+} // namespace sta
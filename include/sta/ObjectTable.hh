@@ -57,6 +57,9 @@ public:
   TYPE &ref(ObjectId id) const;
   ObjectId objectId(const TYPE *object);
   size_t size() const { return size_; }
+  // All object IDs are less than idBound() so it can be used to
+  // size arrays indexed by ObjectId.
+  ObjectId idBound() const { return blocks_.size() << idx_bits; }
   void clear();
 
   // Objects are allocated in blocks of 128.
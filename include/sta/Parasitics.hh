@@ -159,6 +159,16 @@ public:
   virtual ParasiticResistorSeq resistors(const Parasitic *parasitic) const = 0;
   virtual ParasiticCapacitorSeq capacitors(const Parasitic *parasitic) const = 0;
   virtual void deleteParasiticNetwork(const Net *net) = 0;
+  // Delay calculation is finished with the parasitic network of
+  // drvr_pin's net. Parasitics that can rebuild the network when it
+  // is needed again may delete it to save memory.
+  virtual void releaseParasiticNetwork(const Pin *drvr_pin);
+  // Report the messages from parasitic networks read when they were
+  // first needed. Called by the main thread so the messages are
+  // reported in file order rather than by delay calculation threads.
+  virtual void reportNetworkReadMessages();
+  // Number of parasitic networks held in memory.
+  virtual size_t parasiticNetworkCount() const;
   // True if the parasitic network caps include pin capacitances.
   virtual bool includesPinCaps(const Parasitic *parasitic) const = 0;
   // Parasitic network component builders.
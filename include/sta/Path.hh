@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "Delay.hh"
 #include "GraphClass.hh"
 #include "MinMax.hh"
@@ -39,7 +41,15 @@ class Path
 {
 public:
   Path();
+  // Copy of a vertex path. A copy of a path that links to a PathCopy
+  // cannot find its previous path, so PathCopy is only copied with
+  // PathCopy or Path::vertexPath.
   Path(const Path *path);
+  Path(const Path &path);
+  Path(const PathCopy *path) = delete;
+  Path(const PathCopy &path) = delete;
+  Path &operator=(const Path &path);
+  Path &operator=(const PathCopy &path) = delete;
   Path(Vertex *vertex,
        Tag *tag,
        const StaState *sta);
@@ -50,14 +60,6 @@ public:
        Edge *prev_edge,
        TimingArc *prev_arc,
        const StaState *sta);
-  Path(Vertex *vertex,
-       Tag *tag,
-       const Arrival &arrival,
-       Path *prev_path,
-       Edge *prev_edge,
-       TimingArc *prev_arc,
-       bool is_enum,
-       const StaState *sta);
   std::string to_string(const StaState *sta) const;
   bool isNull() const;
   // prev_path null 
@@ -104,9 +106,14 @@ public:
   void setRequired(const Required &required);
   Slack slack(const StaState *sta) const;
   Slew slew(const StaState *sta) const;
-  // This takes the same time as prevPath and prevArc combined.
-  Path *prevPath() const;
-  void setPrevPath(Path *prev_path);
+  // The previous path is found from the path array of the previous
+  // edge from vertex, so this takes the same time as prevPath and
+  // prevArc combined.
+  Path *prevPath(const StaState *sta) const;
+  // The previous path must be in the vertex path array of its vertex
+  // unless this path is a PathCopy.
+  void setPrevPath(Path *prev_path,
+                   const StaState *sta);
   void clearPrevPath(const StaState *sta);
   TimingArc *prevArc(const StaState *sta) const;
   Edge *prevEdge(const StaState *sta) const;
@@ -116,6 +123,8 @@ public:
                       const StaState *sta);
   bool isEnum() const { return is_enum_; }
   void setIsEnum(bool is_enum);
+  // Path is a PathCopy.
+  bool isCopy() const { return is_copy_; }
   void checkPrevPath(const StaState *sta) const;
 
   const MinMax *tgtClkMinMax(const StaState *sta) const;
@@ -159,16 +168,53 @@ public:
                       const StaState *sta);
 
 protected:
-  Path *prev_path_;
+  bool hasPrevPath() const { return prev_index_ != prev_index_null; }
+
   Arrival arrival_;
   Required required_;
   union {
     VertexId vertex_id_;
     EdgeId prev_edge_id_;
   };
+  // Index of the previous path in the path array of the previous edge
+  // from vertex. prev_index_copy when a PathCopy holds a pointer to
+  // the previous path.
+  uint32_t prev_index_;
   TagIndex tag_index_:tag_index_bit_count;
   bool is_enum_:1;
   unsigned prev_arc_idx_:2;
+  bool is_copy_:1;
+
+  static constexpr uint32_t prev_index_null = UINT32_MAX;
+  static constexpr uint32_t prev_index_copy = UINT32_MAX - 1;
+};
+
+// Path copied out of the vertex path arrays for path enumeration and
+// generated clock source paths. The previous path may be another copy
+// so it is a pointer rather than a vertex path array index.
+// Copies must not be assigned to a Path, which would drop the pointer.
+class PathCopy : public Path
+{
+public:
+  PathCopy();
+  PathCopy(const PathCopy &path);
+  // Copy of path that links to the same previous path.
+  PathCopy(const Path *path,
+           const StaState *sta);
+  PathCopy(Vertex *vertex,
+           Tag *tag,
+           const Arrival &arrival,
+           Path *prev_path,
+           Edge *prev_edge,
+           TimingArc *prev_arc,
+           bool is_enum,
+           const StaState *sta);
+  PathCopy &operator=(const PathCopy &path);
+
+protected:
+  Path *prev_path_;
+
+  friend class Path;
 };
 
 // Compare all path attributes (vertex, transition, tag, analysis point).
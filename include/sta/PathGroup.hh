@@ -40,6 +40,7 @@ namespace sta {
 
 class MinMax;
 class PathEndVisitor;
+class MakePathEnds;
 
 using PathGroupIterator = PathEndSeq::iterator;
 using PathGroupClkMap = std::map<const Clock*, PathGroup*>;
@@ -72,10 +73,20 @@ public:
   const MinMax *minMax() const { return min_max_;}
   PathEndSeq pathEnds() const { return path_ends_; }
   void insert(PathEnd *path_end);
+  // Insert path ends collected by PathGroupEnds.
+  void insert(PathEndSeq &path_ends);
   // Push group_path_count into path_ends.
   void pushEnds(PathEndSeq &path_ends);
   // Predicate to determine if a PathEnd is worth saving.
   bool saveable(PathEnd *path_end);
+  // Predicate with a threshold other than the group's.
+  bool saveable(PathEnd *path_end,
+                float threshold) const;
+  float threshold();
+  // Sort path_ends and delete all but the group_path_count path ends
+  // with at most endpoint_path_count per endpoint.
+  // Returns the threshold later path ends need to beat.
+  float pruneEnds(PathEndSeq &path_ends) const;
   bool enumMinSlackUnderMin(PathEnd *path_end);
   size_t maxPaths() const { return group_path_count_; }
   // This does NOT delete the path ends.
@@ -113,6 +124,26 @@ protected:
   const StaState *sta_;
 };
 
+// Path ends for a path group found by one thread. They are pruned
+// like the group path ends without locking the group and inserted
+// into the group by merge() when the thread is done.
+class PathGroupEnds
+{
+public:
+  PathGroupEnds(PathGroup *group);
+  ~PathGroupEnds();
+  bool saveable(PathEnd *path_end) const;
+  void insert(PathEnd *path_end);
+  // Insert the path ends into the group.
+  // Returns the number of path ends merged.
+  size_t merge();
+
+private:
+  PathGroup *group_;
+  PathEndSeq path_ends_;
+  float threshold_;
+};
+
 class PathGroups : public StaState
 {
 public:
@@ -165,11 +196,11 @@ protected:
   void makeGroupPathEnds(ExceptionTo *to,
                          const SceneSeq &scenes,
                          const MinMaxAll *min_max,
-                         PathEndVisitor *visitor);
+                         MakePathEnds *visitor);
   void makeGroupPathEnds(VertexSet &endpoints,
                          const SceneSeq &scenes,
                          const MinMaxAll *min_max,
-                         PathEndVisitor *visitor);
+                         MakePathEnds *visitor);
   void enumPathEnds(PathGroup *group,
                     size_t group_path_count,
                     size_t endpoint_path_count,
@@ -225,6 +256,8 @@ protected:
   static constexpr std::string_view gated_clk_group_name_ = "gated clock";
   static constexpr std::string_view async_group_name_ = "asynchronous";
   static constexpr std::string_view unconstrained_group_name_ = "unconstrained";
+  // Endpoints per task when finding path ends.
+  static constexpr size_t endpoint_grain_size_ = 64;
 };
 
 } // namespace sta
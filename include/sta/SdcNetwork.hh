@@ -41,6 +41,7 @@ public:
   bool linkNetwork(std::string_view top_cell_name,
                    bool make_black_boxes,
                    Report *report) override;
+  void reportMemory() const override;
 
   std::string name(const Library *library) const override;
   ObjectId id(const Library *library) const override;
@@ -114,6 +115,10 @@ public:
   pinIterator(const Instance *instance) const override;
   InstanceNetIterator *
   netIterator(const Instance *instance) const override;
+  void visitChildren(const Instance *instance,
+                     NetworkInstanceVisitor &visitor) const override;
+  void visitPins(const Instance *instance,
+                 NetworkPinVisitor &visitor) const override;
 
   ObjectId id(const Pin *pin) const override;
   Port *port(const Pin *pin) const override;
@@ -140,6 +145,15 @@ public:
   bool isGround(const Net *net) const override;
   NetPinIterator *pinIterator(const Net *net) const override;
   NetTermIterator *termIterator(const Net *net) const override;
+  void visitPins(const Net *net,
+                 NetworkNetPinVisitor &visitor) const override;
+  void visitTerms(const Net *net,
+                  NetworkTermVisitor &visitor) const override;
+  // Pins are not renamed so use the adapted network's visitors.
+  void visitConnectedPins(const Pin *pin,
+                          PinVisitor &visitor) const override;
+  void visitConnectedPins(const Net *net,
+                          PinVisitor &visitor) const override;
 
   ConstantPinIterator *constantPinIterator() override;
 
@@ -179,6 +193,9 @@ public:
   using Network::id;
   using Network::isLeaf;
   using Network::netIterator;
+  using Network::visitChildren;
+  using Network::visitPins;
+  using Network::visitTerms;
   using Network::findPin;
   using Network::libertyLibrary;
   using Network::libertyCell;
@@ -31,6 +31,7 @@
 
 #include "Delay.hh"
 #include "GraphClass.hh"
+#include "InternSet.hh"
 #include "LibertyClass.hh"
 #include "MinMax.hh"
 #include "NetworkClass.hh"
@@ -62,13 +63,13 @@ class WorstSlacks;
 class VisitPathEnds;
 class GatedClk;
 class CheckCrpr;
+class PathPool;
 class Scene;
 
-using ClkInfoSet = std::set<const ClkInfo*, ClkInfoLess>;
+using ClkInfoSet = InternSet<const ClkInfo, ClkInfoHash, ClkInfoEqual>;
 using TagSet = std::unordered_set<Tag*, TagHash, TagEqual>;
-using TagGroupSet = std::unordered_set<TagGroup*, TagGroupHash, TagGroupEqual>;
-using VertexSlackMap = std::map<Vertex*, Slack>;
-using VertexSlackMapSeq = std::vector<VertexSlackMap>;
+using TagInternSet = InternSet<Tag, TagHash, TagEqual>;
+using TagGroupSet = InternSet<TagGroup, TagGroupHash, TagGroupEqual>;
 using WorstSlacksSeq = std::vector<WorstSlacks>;
 using DelayDblSeq = std::vector<DelayDbl>;
 using ExceptionPathSeq = std::vector<ExceptionPath*>;
@@ -157,6 +158,20 @@ public:
                   // Return values.
                   Slack &worst_slack,
                   Vertex *&worst_vertex);
+  // Up to count endpoints with the worst slacks, worst first.
+  // Incrementally updated.
+  void worstSlackVertices(const Scene *scene,
+                          const MinMax *min_max,
+                          size_t count,
+                          // Return value.
+                          VertexSeq &vertices);
+  // Endpoint counts with slack in each bin ending at the bin max.
+  // Endpoints with slack greater than the last bin max are not counted.
+  void slackHistogram(const Scene *scene,
+                      const MinMax *min_max,
+                      const SlackSeq &bin_maxes,
+                      // Return value.
+                      std::vector<size_t> &counts);
   // Clock arrival respecting ideal clock insertion delay and latency.
   Arrival clkPathArrival(const Path *clk_path) const;
   Arrival clkPathArrival(const Path *clk_path,
@@ -214,6 +229,8 @@ public:
   TagGroupIndex tagGroupCount() const;
   void reportTagGroups() const;
   void reportPathCountHistogram() const;
+  // Report vertex path array and tag memory use.
+  void reportSearchMemory() const;
   int clkInfoCount() const;
   // Endpoint for any mode.
   [[nodiscard]] bool isEndpoint(Vertex *vertex) const;
@@ -277,6 +294,18 @@ public:
                                      TagGroupBldr *tag_bldr);
   BfsFwdIterator *arrivalIterator() const { return arrival_iter_; }
   BfsBkwdIterator *requiredIterator() const { return required_iter_; }
+  // Count vertices visited by findRequireds with requireds that
+  // changed beyond the tolerance or were pruned by it.
+  void requiredVisited(bool changed,
+                       bool pruned);
+  // Change in required time (seconds) that is propagated to the fanin
+  // during incremental required updates.
+  float incrementalRequiredTolerance() const
+  { return incremental_required_tolerance_; }
+  void setIncrementalRequiredTolerance(float tolerance);
+  // Vertices revisited by the last findRequireds.
+  size_t requiredChangedCount() const { return required_changed_count_; }
+  size_t requiredPrunedCount() const { return required_pruned_count_; }
   // Used by OpenROAD.
   bool makeUnclkedPaths(Vertex *vertex,
                         bool is_segment_start,
@@ -410,7 +439,7 @@ public:
   void checkPrevPaths() const;
   void deletePaths(Vertex *vertex);
   void deleteTagGroup(TagGroup *group);
-  void saveEnumPath(Path *path);
+  void saveEnumPath(PathCopy *path);
   bool isSrchRoot(Vertex *vertex,
                   const Mode *mode) const;
   DelaysWrtClks arrivalsWrtClks(Vertex *vertex,
@@ -552,9 +581,9 @@ protected:
   void deleteFilterTagGroups();
   void deleteFilterClkInfos();
 
-  void tnsPreamble();
-  void findTotalNegativeSlacks();
+  void findWorstSlacks();
   void updateInvalidTns();
+  float requiredTolerance() const;
   void clearWorstSlack();
   void wnsSlacks(Vertex *vertex,
                  // Return values.
@@ -564,14 +593,6 @@ protected:
   void deleteWorstSlacks();
   void updateWorstSlacks(Vertex *vertex,
                          Slack slacks);
-  void updateTns(Vertex *vertex,
-                 SlackSeq &slacks);
-  void tnsIncr(Vertex *vertex,
-               Slack slack,
-               PathAPIndex path_ap_index);
-  void tnsDecr(Vertex *vertex,
-               PathAPIndex path_ap_index);
-  void tnsNotifyBefore(Vertex *vertex);
   [[nodiscard]] bool matchesFilterTo(Path *path,
                                      const ClockEdge *to_clk_edge) const;
   const Path *pathClkPathArrival1(const Path *path) const;
@@ -610,6 +631,8 @@ protected:
   std::mutex invalid_arrivals_lock_;
   BfsFwdIterator *arrival_iter_;
   ArrivalVisitor *arrival_visitor_;
+  // Vertex path arrays.
+  PathPool *path_pool_;
 
   // Some requireds exist.
   bool requireds_exist_{false};
@@ -618,41 +641,39 @@ protected:
   // Vertices with invalid required times to update and search from.
   VertexSet invalid_requireds_;
   BfsBkwdIterator *required_iter_;
-
-  bool tns_exists_{false};
-  // Endpoint vertices with slacks that have changed since tns was found.
+  // Vertices revisited by the last findRequireds with requireds that
+  // changed and were propagated or were pruned by the tolerance.
+  std::atomic<size_t> required_changed_count_{0};
+  std::atomic<size_t> required_pruned_count_{0};
+  float incremental_required_tolerance_{0.0};
+
+  // Endpoint vertices with slacks that have changed since the
+  // worst slacks were updated.
   VertexSet invalid_tns_;
-  // Indexed by path_ap->index().
-  DelayDblSeq tns_;
-  // Indexed by path_ap->index().
-  VertexSlackMapSeq tns_slacks_;
   std::mutex tns_lock_;
 
-  // Indexed by path_ap->index().
+  // Endpoint slack index used for worst slack and tns.
+  // Only made and incrementally updated after there is a request.
   WorstSlacks *worst_slacks_{nullptr};
 
+  // Initial capacity of the tag, tag group and clk info sets.
+  static constexpr size_t tag_capacity_init_ = 128;
   // Use pointer to clk_info set so Tag.hh does not need to be included.
   ClkInfoSet *clk_info_set_;
-  std::mutex clk_info_lock_;
 
   // Entries in tags_ may be missing where previous filter tags were deleted.
-  TagIndex tag_capacity_{128};
-  std::atomic<Tag **> tags_;
+  InternIndexTable<Tag> tags_;
   // Use pointer to tag set so Tag.hh does not need to be included.
-  TagSet *tag_set_;
-  std::vector<Tag **> tags_prev_;
-  TagIndex tag_next_{0};
-  std::mutex tag_lock_;
-
-  // Capacity of tag_groups_.
-  TagGroupIndex tag_group_capacity_;
-  std::atomic<TagGroup **> tag_groups_;
+  TagInternSet *tag_set_;
+  std::atomic<TagIndex> tag_next_{0};
+
+  InternIndexTable<TagGroup> tag_groups_;
   TagGroupSet *tag_group_set_;
-  std::vector<TagGroup **> tag_groups_prev_;
-  TagGroupIndex tag_group_next_{0};
+  std::atomic<TagGroupIndex> tag_group_next_{0};
   // Holes in tag_groups_ left by deleting filter tag groups.
   std::vector<TagIndex> tag_group_free_indices_;
-  std::mutex tag_group_lock_;
+  // Only held while allocating a tag group index.
+  std::mutex tag_group_index_lock_;
 
   // Arrivals to queue on the next search pass.
   VertexSet pending_arrivals_;
@@ -670,7 +691,8 @@ protected:
   std::mutex filtered_arrivals_lock_;
 
   bool found_downstream_clk_pins_{false};
-  std::vector<Path*> enum_paths_;
+  std::vector<PathCopy*> enum_paths_;
+  std::mutex enum_paths_lock_;
 
   VisitPathEnds *visit_path_ends_;
   GatedClk *gated_clk_;
@@ -832,14 +854,21 @@ public:
                    Required &required,
                    const MinMax *min_max,
                    const StaState *sta);
-  // Return true if the requireds changed.
+  // Return true if the requireds changed by more than the tolerance
+  // (seconds) so they need to be propagated to the fanin. Requireds
+  // that only changed within the tolerance are not saved.
   bool requiredsSave(Vertex *vertex,
+                     float tolerance,
                      const StaState *sta);
+  // True if the last requiredsSave changed requireds by less than
+  // the tolerance.
+  [[nodiscard]] bool requiredsPruned() const { return requireds_pruned_; }
   Required required(size_t path_index);
 
 protected:
   ArrivalSeq requireds_{10};
   bool have_requireds_{false};
+  bool requireds_pruned_{false};
 };
 
 // Visitor called during backward search to record a
@@ -847,7 +876,8 @@ protected:
 class RequiredVisitor : public PathVisitor
 {
 public:
-  RequiredVisitor(const StaState *sta);
+  RequiredVisitor(float tolerance,
+                  const StaState *sta);
   RequiredVisitor(const RequiredVisitor &required_visitor);
   ~RequiredVisitor() override;
   VertexVisitor *copy() const override;
@@ -871,6 +901,7 @@ public:
 protected:
   RequiredCmp required_cmp_;
   VisitPathEnds *visit_path_ends_;
+  float tolerance_;
 };
 
 } // namespace sta
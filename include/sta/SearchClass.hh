@@ -43,6 +43,7 @@ namespace sta {
 class Search;
 class Scene;
 class Path;
+class PathCopy;
 class PathEnd;
 class PathGroup;
 class Tag;
@@ -112,6 +113,7 @@ using ArrivalSeq = std::vector<Arrival>;
 using VertexPathCountMap = std::map<Vertex*, size_t>;
 using PathIndexMap = VectorMap<Tag*, size_t, TagMatchLess>;
 using SlackSeq = std::vector<Slack>;
+using VertexSlackMap = std::map<Vertex*, Slack>;
 using Crpr = Delay;
 using PathSeq = std::vector<Path*>;
 using ConstPathSeq = std::vector<const Path*>;
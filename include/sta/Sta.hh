@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -72,6 +74,7 @@ class Scene;
 class ClkSkews;
 class ReportField;
 class EquivCells;
+class TablePool;
 class StaSimObserver;
 class LevelizeObserver;
 class GraphLoop;
@@ -1132,6 +1135,16 @@ public:
                   // Return values.
                   Slack &worst_slack,
                   Vertex *&worst_vertex);
+  // Up to count endpoints with the worst slacks, worst first.
+  // Incrementally updated.
+  VertexSeq worstSlackVertices(const Scene *scene,
+                               const MinMax *min_max,
+                               size_t count);
+  // Endpoint counts with slack in each bin ending at the bin max.
+  // Endpoints with slack greater than the last bin max are not counted.
+  std::vector<size_t> slackHistogram(const Scene *scene,
+                                     const MinMax *min_max,
+                                     const SlackSeq &bin_maxes);
   Path *vertexWorstArrivalPath(Vertex *vertex,
                                const RiseFall *rf,
                                const MinMax *min_max);
@@ -1265,7 +1278,8 @@ public:
                 bool pin_cap_included,
                 bool keep_coupling_caps,
                 float coupling_cap_factor,
-                bool reduce);
+                bool reduce,
+                bool lazy);
   Parasitics *findParasitics(const std::string &name);
   void reportParasiticAnnotation(const std::string &spef_name,
                                  bool report_unannotated);
@@ -1385,6 +1399,11 @@ public:
   void setLevelizeObserver(LevelizeObserver *observer);
   // Ensure that the timing graph has been built.
   Graph *ensureGraph();
+  // Remake the timing graph with vertices and edges numbered in level
+  // order so that vertices visited together are near each other in
+  // memory. All timing is invalidated and delay/slew annotations on the
+  // graph are removed.
+  void compactGraph();
   void ensureClkArrivals();
 
   // Find all arc delays and vertex slews with delay calculator.
@@ -1397,6 +1416,10 @@ public:
   // delays to be recomputed during incremental delay calculation.
   // Defaults to 0.0 for maximum accuracy and slowest incremental speed.
   void setIncrementalDelayTolerance(float tol);
+  // Change in required time (seconds) that is propagated to the fanin
+  // during incremental required time updates. Smaller changes are not
+  // saved or propagated. Defaults to 0.0 to propagate every change.
+  void setIncrementalRequiredTolerance(float tol);
   // Make graph and find delays.
   void searchPreamble();
 
@@ -1434,6 +1457,9 @@ public:
   void reportPowerInstsJson(const InstanceSeq &insts,
                             const Scene *scene,
                             int digits);
+  // Liberty tables shared between libraries. Null before a liberty
+  // file is read.
+  const TablePool *tablePool() const { return table_pool_; }
   Power *power() { return power_; }
   const Power *power() const { return power_; }
   void power(const Scene *scene,
@@ -1557,6 +1583,12 @@ public:
   // TCL variable sta_pin_name_compatibility.
   bool pinNameCompatibility() const;
   void setPinNameCompatibility(bool enable);
+  // TCL variable sta_dataflow_propagation.
+  bool dataflowPropagation() const;
+  void setDataflowPropagation(bool enable);
+  // TCL variable sta_concurrent_modes.
+  bool concurrentModes() const;
+  void setConcurrentModes(bool enable);
   ////////////////////////////////////////////////////////////////
 
   Properties &properties() { return properties_; }
@@ -1572,6 +1604,8 @@ protected:
   virtual void makeNetwork();
   virtual void makeSdcNetwork();
   virtual void makeGraph();
+  // Delete the graph and the state that references it.
+  void deleteGraph();
   virtual void makeDefaultScene();
   virtual void makeLevelize();
   virtual void makeArcDelayCalc();
@@ -1596,6 +1630,8 @@ protected:
                                   const MinMaxAll *min_max,
                                   bool infer_latches);
   void delayCalcPreamble();
+  // Call visit on each mode, in parallel when sta_concurrent_modes is set.
+  void visitModes(const std::function<void (Mode *mode)> &visit);
   void delaysInvalidFrom(const Port *port);
   void delaysInvalidFromFanin(const Port *port);
   void deleteEdge(Edge *edge);
@@ -1724,7 +1760,13 @@ protected:
   Power *power_{nullptr};
   Tcl_Interp *tcl_interp_{nullptr};
   bool update_genclks_{false};
+  // Serializes invalidations from the sim observers of concurrent modes.
+  std::mutex sim_observer_lock_;
   EquivCells *equiv_cells_{nullptr};
+  // Liberty tables shared by the libraries read in this session.
+  TablePool *table_pool_{nullptr};
+  // Vertex order used by makeGraph while compactGraph rebuilds the graph.
+  const PinSeq *graph_pin_order_{nullptr};
   Properties properties_{this};
   bool liberty_line_debug_{false};
 
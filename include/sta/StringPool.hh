@@ -0,0 +1,99 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace sta {
+
+// Interned null terminated strings. Equal strings share one reference
+// counted copy. The characters are allocated from large blocks and the
+// index is an open addressed hash table of string views, so there is no
+// per string heap allocation. Released strings are kept on free lists
+// by size and their space is reused by later strings.
+// The length and reference count of each string are stored before its
+// characters so length() does not have to search for the terminator.
+// Not thread safe.
+class StringPool
+{
+public:
+  StringPool() = default;
+  // Return the pooled copy of str and add a reference to it.
+  const char *intern(std::string_view str);
+  // Remove a reference added by intern. The string is freed with its
+  // last reference.
+  void release(const char *pooled);
+  // Return the pooled copy of str or nullptr if it is not in the pool.
+  const char *find(std::string_view str) const;
+  // Length of a string returned by intern or find.
+  static size_t length(const char *pooled);
+  static std::string_view view(const char *pooled);
+  // Free all of the strings.
+  void clear();
+  // Unique strings.
+  size_t size() const { return size_; }
+  // Bytes of the strings in the pool, including their headers,
+  // terminators and padding.
+  size_t charBytes() const { return char_bytes_; }
+  // Bytes allocated for characters and the index.
+  size_t allocatedBytes() const;
+
+private:
+  using Length = uint32_t;
+  using RefCount = uint32_t;
+
+  size_t slotIndex(std::string_view str) const;
+  void grow();
+  void eraseSlot(const char *pooled);
+  const char *copy(std::string_view str);
+  static size_t copyBytes(size_t length);
+  static RefCount refCount(const char *pooled);
+  static void setRefCount(const char *pooled,
+                          RefCount ref_count);
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  size_t block_bytes_{0};
+  // Unused characters at the end of the last block.
+  char *next_{nullptr};
+  size_t next_count_{0};
+  // Free lists of released strings indexed by copyBytes / copy_align_.
+  // The next free string is stored at the start of each one.
+  std::vector<char*> free_lists_;
+  // Open addressed hash table with linear probing.
+  std::vector<std::string_view> slots_;
+  int slot_bits_{0};
+  size_t size_{0};
+  size_t char_bytes_{0};
+
+  static constexpr size_t header_size_ = sizeof(RefCount) + sizeof(Length);
+  static constexpr size_t copy_align_ = 8;
+  static constexpr size_t block_size_ = 1 << 16;
+};
+
+} // namespace sta
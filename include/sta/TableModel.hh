@@ -25,7 +25,9 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -45,6 +47,7 @@ class TableModels;
 class Table;
 class TableModel;
 class TableAxis;
+class TableLookup;
 class OutputWaveforms;
 
 using FloatSeq = std::vector<float>;
@@ -79,6 +82,14 @@ public:
                  // Return values.
                  float &gate_delay,
                  float &drvr_slew) const override;
+  // Find the delay and slew reusing the axis positions in lookup.
+  void gateDelay(const Pvt *pvt,
+                 float in_slew,
+                 float load_cap,
+                 TableLookup &lookup,
+                 // Return values.
+                 float &gate_delay,
+                 float &drvr_slew) const;
   // Fill in pocv parameters in gate_delay, drvr_slew.
   void gateDelayPocv(const Pvt *pvt,
                      float in_slew,
@@ -121,6 +132,15 @@ protected:
                   float in_slew,
                   float load_cap,
                   float related_out_cap) const;
+  // Find the values of models at in_slew/load_cap. Models that share
+  // axes share one lookup. Null models have value zero.
+  void findValues(const Pvt *pvt,
+                  std::span<const TableModel *const> models,
+                  float in_slew,
+                  float load_cap,
+                  TableLookup &lookup,
+                  // Return values.
+                  float *values) const;
   std::string reportTableLookup(std::string_view result_name,
                                 const Pvt *pvt,
                                 const TableModel *model,
@@ -177,6 +197,12 @@ protected:
                   float from_slew,
                   float to_slew,
                   float related_out_cap) const;
+  float findValue(const Pvt *pvt,
+                  const TableModel *model,
+                  float from_slew,
+                  float to_slew,
+                  float related_out_cap,
+                  TableLookup &lookup) const;
   void findAxisValues(float from_slew,
                       float to_slew,
                       float related_out_cap,
@@ -214,6 +240,9 @@ public:
   float axisValue(size_t index) const { return values_[index]; }
   // Find the index for value such that axis[index] <= value < axis[index+1].
   size_t findAxisIndex(float value) const;
+  // Find the axis index checking hint, a previous index, first.
+  size_t findAxisIndex(float value,
+                       size_t hint) const;
   void findAxisIndex(float value,
                      // Return values.
                      size_t &index,
@@ -224,8 +253,18 @@ public:
   float max() const;
 
 private:
+  void makeBuckets();
+  size_t bucket(float value) const;
+
   TableAxisVariable variable_;
   FloatSeq values_;
+  // Uniform buckets between the first and last axis values holding the
+  // index of the last value in a preceding bucket. Empty if the values
+  // are not increasing.
+  std::vector<uint32_t> bucket_indices_;
+  float bucket_scale_;
+
+  static constexpr size_t buckets_per_value_ = 2;
 };
 
 // 0, 1, 2, or 3 dimension float tables.
@@ -272,6 +311,23 @@ public:
   float findValue(float axis_value1,
                   float axis_value2,
                   float axis_value3) const;
+  // Table interpolated lookup at an axis position found by lookup.
+  float findValue(const TableLookup &lookup) const;
+  // Interpolated lookup of count points. The axis value arrays for
+  // axes the table does not have may be null.
+  void findValues(size_t count,
+                  const float *axis_values1,
+                  const float *axis_values2,
+                  const float *axis_values3,
+                  // Return values.
+                  float *values) const;
+  // Interpolated lookup of tables with the same axes at one axis
+  // position, such as the delay, slew and sigma tables of an arc.
+  // The interpolation weights are only found once.
+  static void findValues(const TableLookup &lookup,
+                         std::span<const Table *const> tables,
+                         // Return values.
+                         float *values);
   // One-argument lookup (order 1).
   void findValue(float axis_value1,
                  float &value,
@@ -306,8 +362,8 @@ public:
 
 private:
   void clear();
-  float findValueOrder2(float axis_value1, float axis_value2) const;
-  float findValueOrder3(float axis_value1, float axis_value2, float axis_value3) const;
+  float findValueOrder2(const TableLookup &lookup) const;
+  float findValueOrder3(const TableLookup &lookup) const;
   std::string reportValueOrder0(std::string_view result_name,
                                 std::string_view comment1,
                                 const Unit *table_unit,
@@ -346,6 +402,56 @@ private:
   TableAxisPtr axis3_;
 };
 
+// Axis indices and interpolation fractions for a table lookup.
+// Tables with the same axes (delay/slew, sigma) share a lookup so the
+// axes are only searched once. Axis positions are also reused when
+// the next lookup has the same axis value, and the previous index is
+// tried first when it changes. Callers that repeat lookups with
+// nearby values, like the Ceff iteration, keep one lookup per thread.
+class TableLookup
+{
+public:
+  TableLookup();
+  TableLookup(const Table *table,
+              float axis_value1,
+              float axis_value2,
+              float axis_value3);
+  void find(const Table *table,
+            float axis_value1,
+            float axis_value2,
+            float axis_value3);
+  // True if table has the axes of the last lookup.
+  bool sameAxes(const Table *table) const;
+  size_t index1() const { return index1_; }
+  size_t index2() const { return index2_; }
+  size_t index3() const { return index3_; }
+  double dx1() const { return dx1_; }
+  double dx2() const { return dx2_; }
+  double dx3() const { return dx3_; }
+
+private:
+  static void findAxis(const TableAxis *axis,
+                       float axis_value,
+                       bool use_hint,
+                       // Return values.
+                       size_t &index,
+                       double &dx);
+
+  int order_;
+  const TableAxis *axis1_;
+  const TableAxis *axis2_;
+  const TableAxis *axis3_;
+  float axis_value1_;
+  float axis_value2_;
+  float axis_value3_;
+  size_t index1_;
+  size_t index2_;
+  size_t index3_;
+  double dx1_;
+  double dx2_;
+  double dx3_;
+};
+
 // Wrapper class for Table to apply scale factors.
 class TableModel
 {
@@ -378,6 +484,16 @@ public:
                   float value1,
                   float value2,
                   float value3) const;
+  float findValue(const LibertyCell *cell,
+                  const Pvt *pvt,
+                  const TableLookup &lookup) const;
+  // Lookup of models with the same axes at one axis position.
+  static void findValues(const LibertyCell *cell,
+                         const Pvt *pvt,
+                         const TableLookup &lookup,
+                         std::span<const TableModel *const> models,
+                         // Return values.
+                         float *values);
   std::string reportValue(std::string_view result_name,
                           const LibertyCell *cell,
                           const Pvt *pvt,
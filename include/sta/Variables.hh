@@ -115,6 +115,17 @@ public:
   // register clock/data/Q pin on the same instance. Default off.
   bool pinNameCompatibility() const { return pin_name_compatibility_; }
   void setPinNameCompatibility(bool enable) { pin_name_compatibility_ = enable; }
+  // TCL variable sta_dataflow_propagation.
+  // Propagate delays and arrivals with threads by visiting each vertex
+  // as soon as its fanin is finished instead of level by level.
+  bool dataflowPropagation() const { return dataflow_propagation_; }
+  void setDataflowPropagation(bool enable) { dataflow_propagation_ = enable; }
+  // TCL variable sta_concurrent_modes.
+  // Propagate constants and find clock networks for each mode
+  // concurrently on separate threads. Each mode uses one thread.
+  // Generated clock searches and path end gathering stay serial.
+  bool concurrentModes() const { return concurrent_modes_; }
+  void setConcurrentModes(bool enable) { concurrent_modes_ = enable; }
 
 
 private:
@@ -144,6 +155,8 @@ private:
   bool enable_collections_{false};
   bool case_insensitive_matching_{false};
   bool pin_name_compatibility_{false};
+  bool dataflow_propagation_{false};
+  bool concurrent_modes_{false};
 };
 
 } // namespace sta
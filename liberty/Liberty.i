@@ -29,6 +29,7 @@
 #include "EquivCells.hh"
 #include "LibertyWriter.hh"
 #include "Sta.hh"
+#include "liberty/TablePool.hh"
 
 using namespace sta;
 
@@ -146,6 +147,21 @@ write_lib_db_cmd(LibertyLibrary *library,
   Sta::sta()->writeLibDb(library, filename);
 }
 
+// Number of tables in the table pool (for regressions).
+int
+table_pool_table_count()
+{
+  const TablePool *table_pool = Sta::sta()->tablePool();
+  return table_pool ? table_pool->tableCount() : 0;
+}
+
+int
+table_pool_axis_count()
+{
+  const TablePool *table_pool = Sta::sta()->tablePool();
+  return table_pool ? table_pool->axisCount() : 0;
+}
+
 void
 make_equiv_cells(LibertyLibrary *lib)
 {
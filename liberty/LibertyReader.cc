@@ -56,6 +56,7 @@
 #include "Sequential.hh"
 #include "StringUtil.hh"
 #include "TableModel.hh"
+#include "TablePool.hh"
 #include "TimingArc.hh"
 #include "TimingModel.hh"
 #include "Transition.hh"
@@ -73,17 +74,20 @@ scaleFloats(FloatSeq &floats,
 LibertyLibrary *
 readLibertyFile(std::string_view filename,
                 bool infer_latches,
-                Network *network)
+                Network *network,
+                TablePool *table_pool)
 {
-  LibertyReader reader(filename, infer_latches, network);
+  LibertyReader reader(filename, infer_latches, network, table_pool);
   return reader.readLibertyFile(filename);
 }
 
 LibertyReader::LibertyReader(std::string_view filename,
                              bool infer_latches,
-                             Network *network) :
+                             Network *network,
+                             TablePool *table_pool) :
   filename_(filename),
   infer_latches_(infer_latches),
+  table_pool_(table_pool),
   report_(network->report()),
   debug_(network->debug()),
   network_(network),
@@ -610,7 +614,7 @@ LibertyReader::makeTableTemplateAxis(const LibertyGroup *template_group,
       const Units *units = library_->units();
       float scale = tableVariableUnit(axis_var, units)->scale();
       scaleFloats(axis_values, scale);
-      return make_shared<TableAxis>(axis_var, std::move(axis_values));
+      return shareAxis(make_shared<TableAxis>(axis_var, std::move(axis_values)));
     }
   }
   return nullptr;
@@ -2549,6 +2553,9 @@ LibertyReader::readTableModel(const LibertyGroup *table_group,
     if (tbl_template) {
       TablePtr table = readTableModel(table_group, tbl_template, scale);
       if (table) {
+        // Output current tables are split up after they are read.
+        if (table_pool_ && template_type != TableTemplateType::output_current)
+          table = table_pool_->shareTable(table);
         TableModel *table_model = new TableModel(table, tbl_template,
                                                  scale_factor_type, rf);
         if (!check_axes(table_model)) {
@@ -2601,6 +2608,14 @@ LibertyReader::readTableModel(const LibertyGroup *table_group,
   return nullptr;
 }
 
+TableAxisPtr
+LibertyReader::shareAxis(TableAxisPtr axis)
+{
+  if (table_pool_)
+    return table_pool_->shareAxis(axis);
+  return axis;
+}
+
 TableAxisPtr
 LibertyReader::makeTableAxis(const LibertyGroup *table_group,
                              std::string_view index_attr_name,
@@ -2625,7 +2640,7 @@ LibertyReader::makeTableAxis(const LibertyGroup *table_group,
       const Units *units = library_->units();
       float scale = tableVariableUnit(axis_var, units)->scale();
       scaleFloats(axis_values, scale);
-      return make_shared<TableAxis>(axis_var, std::move(axis_values));
+      return shareAxis(make_shared<TableAxis>(axis_var, std::move(axis_values)));
     }
   }
   return template_axis;
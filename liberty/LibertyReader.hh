@@ -30,10 +30,14 @@ namespace sta {
 
 class Network;
 class LibertyLibrary;
+class TablePool;
 
+// Tables are shared with other libraries through table_pool if it is
+// not null.
 LibertyLibrary *
 readLibertyFile(std::string_view filename,
                 bool infer_latches,
-                Network *network);
+                Network *network,
+                TablePool *table_pool = nullptr);
 
 } // namespace sta
@@ -55,6 +55,7 @@ class LibertyReader;
 class PortNameBitIterator;
 class TimingArcBuilder;
 class OutputWaveform;
+class TablePool;
 
 using LibraryGroupVisitor = void (LibertyReader::*)(const LibertyGroup *group,
                                                     LibertyGroup *parent_group);
@@ -68,7 +69,8 @@ class LibertyReader : public LibertyGroupVisitor
 public:
   LibertyReader(std::string_view filename,
                 bool infer_latches,
-                Network *network);
+                Network *network,
+                TablePool *table_pool = nullptr);
   LibertyLibrary *readLibertyFile(std::string_view filename);
   LibertyLibrary *library() { return library_; }
   const LibertyLibrary *library() const { return library_; }
@@ -303,6 +305,7 @@ protected:
   TableAxisPtr makeTableAxis(const LibertyGroup *table_group,
                              std::string_view index_attr_name,
                              TableAxisPtr template_axis);
+  TableAxisPtr shareAxis(TableAxisPtr axis);
   void readGroupAttrFloat(std::string_view attr_name,
                           const LibertyGroup *group,
                           const std::function<void(float)> &set_func,
@@ -520,6 +523,8 @@ protected:
 
   std::string_view filename_;
   bool infer_latches_;
+  // Shares tables with the other libraries in the session. May be null.
+  TablePool *table_pool_;
   Report *report_;
   Debug *debug_;
   Network *network_;
@@ -25,6 +25,7 @@
 #include "TableModel.hh"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <memory>
@@ -44,6 +45,13 @@
 #include "Transition.hh"
 #include "Units.hh"
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define STA_TABLE_SIMD 1
+#else
+#define STA_TABLE_SIMD 0
+#endif
+
 namespace sta {
 
 size_t
@@ -57,6 +65,127 @@ static void
 appendSpaces(std::string &result,
              int count);
 
+////////////////////////////////////////////////////////////////
+
+// Axis positions and corner values of a block of order 2 table
+// lookups for the interpolation kernels.
+struct Interpolate2Block
+{
+  static constexpr size_t size = 64;
+  // Axis values and the axis values below and above them.
+  std::array<double, size> x1, x1l, x1u;
+  std::array<double, size> x2, x2l, x2u;
+  // Corner values.
+  std::array<double, size> y00, y10, y11, y01;
+};
+
+// Bilinear interpolation of the first count points of block.
+// The arithmetic is in the same order as TableLookup::findAxis and
+// Table::findValueOrder2 so all versions return identical results.
+
+static void
+interpolate2Scalar(const Interpolate2Block &block,
+                   size_t start,
+                   size_t count,
+                   // Return values.
+                   float *values)
+{
+  for (size_t i = start; i < count; i++) {
+    double dx1 = (block.x1[i] - block.x1l[i]) / (block.x1u[i] - block.x1l[i]);
+    double dx2 = (block.x2[i] - block.x2l[i]) / (block.x2u[i] - block.x2l[i]);
+    values[i] = (1 - dx1) * (1 - dx2) * block.y00[i]
+      + dx1 * (1 - dx2) * block.y10[i]
+      + dx1 * dx2 * block.y11[i]
+      + (1 - dx1) * dx2 * block.y01[i];
+  }
+}
+
+#if STA_TABLE_SIMD
+
+__attribute__((target("avx2"))) static void
+interpolate2Avx2(const Interpolate2Block &block,
+                 size_t start,
+                 size_t count,
+                 // Return values.
+                 float *values)
+{
+  const __m256d one = _mm256_set1_pd(1.0);
+  size_t i = start;
+  for (; i + 4 <= count; i += 4) {
+    __m256d x1l = _mm256_loadu_pd(&block.x1l[i]);
+    __m256d x2l = _mm256_loadu_pd(&block.x2l[i]);
+    __m256d dx1 = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(&block.x1[i]), x1l),
+                                _mm256_sub_pd(_mm256_loadu_pd(&block.x1u[i]), x1l));
+    __m256d dx2 = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(&block.x2[i]), x2l),
+                                _mm256_sub_pd(_mm256_loadu_pd(&block.x2u[i]), x2l));
+    __m256d ux1 = _mm256_sub_pd(one, dx1);
+    __m256d ux2 = _mm256_sub_pd(one, dx2);
+    // No fused multiply-add so the rounding matches the scalar code.
+    __m256d sum = _mm256_mul_pd(_mm256_mul_pd(ux1, ux2),
+                                _mm256_loadu_pd(&block.y00[i]));
+    sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_mul_pd(dx1, ux2),
+                                           _mm256_loadu_pd(&block.y10[i])));
+    sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_mul_pd(dx1, dx2),
+                                           _mm256_loadu_pd(&block.y11[i])));
+    sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_mul_pd(ux1, dx2),
+                                           _mm256_loadu_pd(&block.y01[i])));
+    _mm_storeu_ps(values + i, _mm256_cvtpd_ps(sum));
+  }
+  interpolate2Scalar(block, i, count, values);
+}
+
+__attribute__((target("avx512f"))) static void
+interpolate2Avx512(const Interpolate2Block &block,
+                   size_t start,
+                   size_t count,
+                   // Return values.
+                   float *values)
+{
+  const __m512d one = _mm512_set1_pd(1.0);
+  size_t i = start;
+  for (; i + 8 <= count; i += 8) {
+    __m512d x1l = _mm512_loadu_pd(&block.x1l[i]);
+    __m512d x2l = _mm512_loadu_pd(&block.x2l[i]);
+    __m512d dx1 = _mm512_div_pd(_mm512_sub_pd(_mm512_loadu_pd(&block.x1[i]), x1l),
+                                _mm512_sub_pd(_mm512_loadu_pd(&block.x1u[i]), x1l));
+    __m512d dx2 = _mm512_div_pd(_mm512_sub_pd(_mm512_loadu_pd(&block.x2[i]), x2l),
+                                _mm512_sub_pd(_mm512_loadu_pd(&block.x2u[i]), x2l));
+    __m512d ux1 = _mm512_sub_pd(one, dx1);
+    __m512d ux2 = _mm512_sub_pd(one, dx2);
+    __m512d sum = _mm512_mul_pd(_mm512_mul_pd(ux1, ux2),
+                                _mm512_loadu_pd(&block.y00[i]));
+    sum = _mm512_add_pd(sum, _mm512_mul_pd(_mm512_mul_pd(dx1, ux2),
+                                           _mm512_loadu_pd(&block.y10[i])));
+    sum = _mm512_add_pd(sum, _mm512_mul_pd(_mm512_mul_pd(dx1, dx2),
+                                           _mm512_loadu_pd(&block.y11[i])));
+    sum = _mm512_add_pd(sum, _mm512_mul_pd(_mm512_mul_pd(ux1, dx2),
+                                           _mm512_loadu_pd(&block.y01[i])));
+    _mm256_storeu_ps(values + i, _mm512_maskz_cvtpd_ps(0xff, sum));
+  }
+  interpolate2Avx2(block, i, count, values);
+}
+
+#endif
+
+// Use the widest vector instructions the cpu supports.
+static void
+interpolate2(const Interpolate2Block &block,
+             size_t count,
+             // Return values.
+             float *values)
+{
+#if STA_TABLE_SIMD
+  if (__builtin_cpu_supports("avx512f"))
+    interpolate2Avx512(block, 0, count, values);
+  else if (__builtin_cpu_supports("avx2"))
+    interpolate2Avx2(block, 0, count, values);
+  else
+#endif
+    interpolate2Scalar(block, 0, count, values);
+}
+
+////////////////////////////////////////////////////////////////
+
 TimingModel::TimingModel(LibertyCell *cell) :
   cell_(cell)
 {
@@ -117,17 +246,26 @@ GateTableModel::gateDelay(const Pvt *pvt,
                           float &gate_delay,
                           float &drvr_slew) const
 {
-  if (delay_models_ && delay_models_->model())
-    gate_delay = findValue(pvt, delay_models_->model(), in_slew, load_cap, 0.0);
-  else
-    gate_delay = 0.0;
-  if (slew_models_ && slew_models_->model()) {
-    drvr_slew = findValue(pvt, slew_models_->model(), in_slew, load_cap, 0.0);
-    // Clip negative slews to zero.
-    drvr_slew = std::max(drvr_slew, 0.0F);
-  }
-  else
-    drvr_slew = 0.0;
+  TableLookup lookup;
+  gateDelay(pvt, in_slew, load_cap, lookup, gate_delay, drvr_slew);
+}
+
+void
+GateTableModel::gateDelay(const Pvt *pvt,
+                          float in_slew,
+                          float load_cap,
+                          TableLookup &lookup,
+                          // return values
+                          float &gate_delay,
+                          float &drvr_slew) const
+{
+  // Delay and slew tables usually share axes.
+  std::array<const TableModel *, 2> models{delayModel(), slewModel()};
+  std::array<float, 2> values;
+  findValues(pvt, models, in_slew, load_cap, lookup, values.data());
+  gate_delay = values[0];
+  // Clip negative slews to zero.
+  drvr_slew = std::max(values[1], 0.0F);
 }
 
 void
@@ -140,61 +278,45 @@ GateTableModel::gateDelayPocv(const Pvt *pvt,
                               ArcDelay &gate_delay,
                               Slew &drvr_slew) const
 {
+  TableLookup lookup;
   switch (pocv_mode) {
   case PocvMode::normal: {
-    // Delay
-    TableModel *std_dev_model = delay_models_->stdDev();
-    if (std_dev_model == nullptr)
-      std_dev_model = delay_models_->sigma(min_max);
-    if (std_dev_model) {
-      float std_dev = findValue(pvt, std_dev_model, in_slew, load_cap, 0.0);
-      gate_delay.setStdDev(std_dev);
-    }
-
-    // Slew
-    std_dev_model = slew_models_->stdDev();
-    if (std_dev_model == nullptr)
-      std_dev_model = slew_models_->sigma(min_max);
-    if (std_dev_model) {
-      float std_dev = findValue(pvt, std_dev_model, in_slew, load_cap, 0.0);
-      drvr_slew.setStdDev(std_dev);
-    }
+    const TableModel *delay_std_dev = delay_models_->stdDev();
+    if (delay_std_dev == nullptr)
+      delay_std_dev = delay_models_->sigma(min_max);
+    const TableModel *slew_std_dev = slew_models_->stdDev();
+    if (slew_std_dev == nullptr)
+      slew_std_dev = slew_models_->sigma(min_max);
+    std::array<const TableModel *, 2> models{delay_std_dev, slew_std_dev};
+    std::array<float, 2> values;
+    findValues(pvt, models, in_slew, load_cap, lookup, values.data());
+    if (delay_std_dev)
+      gate_delay.setStdDev(values[0]);
+    if (slew_std_dev)
+      drvr_slew.setStdDev(values[1]);
     break;
   }
   case PocvMode::skew_normal: {
+    std::array<const TableModel *, 6> models{
+      delay_models_->meanShift(), delay_models_->stdDev(),
+      delay_models_->skewness(), slew_models_->meanShift(),
+      slew_models_->stdDev(), slew_models_->skewness()};
+    std::array<float, 6> values;
+    findValues(pvt, models, in_slew, load_cap, lookup, values.data());
     // Delay
-    if (delay_models_->meanShift()) {
-      float mean_shift = findValue(pvt, delay_models_->meanShift(),
-                                   in_slew, load_cap, 0.0);
-      gate_delay.setMeanShift(mean_shift);
-    }
-
-    if (delay_models_->stdDev()) {
-      float std_dev = findValue(pvt, delay_models_->stdDev(), in_slew, load_cap, 0.0);
-      gate_delay.setStdDev(std_dev);
-    }
-
-    if (delay_models_->skewness()) {
-      float skewness = findValue(pvt, delay_models_->skewness(), in_slew, load_cap, 0.0);
-      gate_delay.setSkewness(skewness);
-    }
-
+    if (models[0])
+      gate_delay.setMeanShift(values[0]);
+    if (models[1])
+      gate_delay.setStdDev(values[1]);
+    if (models[2])
+      gate_delay.setSkewness(values[2]);
     // Slew
-    if (slew_models_->meanShift()) {
-      float mean_shift = findValue(pvt, slew_models_->meanShift(),
-                                   in_slew, load_cap, 0.0);
-      drvr_slew.setMeanShift(mean_shift);
-    }
-
-    if (slew_models_->stdDev()) {
-      float std_dev = findValue(pvt, slew_models_->stdDev(), in_slew, load_cap, 0.0);
-      drvr_slew.setStdDev(std_dev);
-    }
-
-    if (slew_models_->skewness()) {
-      float skewness = findValue(pvt, slew_models_->skewness(), in_slew, load_cap, 0.0);
-      drvr_slew.setSkewness(skewness);
-    }
+    if (models[3])
+      drvr_slew.setMeanShift(values[3]);
+    if (models[4])
+      drvr_slew.setStdDev(values[4]);
+    if (models[5])
+      drvr_slew.setSkewness(values[5]);
     break;
   }
   default:
@@ -286,6 +408,40 @@ GateTableModel::findValue(const Pvt *pvt,
     return 0.0;
 }
 
+void
+GateTableModel::findValues(const Pvt *pvt,
+                           std::span<const TableModel *const> models,
+                           float in_slew,
+                           float load_cap,
+                           TableLookup &lookup,
+                           // Return values.
+                           float *values) const
+{
+  size_t i = 0;
+  while (i < models.size()) {
+    const TableModel *model = models[i];
+    if (model == nullptr) {
+      values[i] = 0.0;
+      i++;
+    }
+    else {
+      float axis_value1, axis_value2, axis_value3;
+      findAxisValues(model, in_slew, load_cap, 0.0, axis_value1,
+                     axis_value2, axis_value3);
+      lookup.find(model->table().get(), axis_value1, axis_value2, axis_value3);
+      // Batch the following models with the same axes.
+      size_t j = i + 1;
+      while (j < models.size()
+             && models[j]
+             && lookup.sameAxes(models[j]->table().get()))
+        j++;
+      TableModel::findValues(cell_, pvt, lookup, models.subspan(i, j - i),
+                             values + i);
+      i = j;
+    }
+  }
+}
+
 void
 GateTableModel::findAxisValues(const TableModel *model,
                                float in_slew,
@@ -477,8 +633,9 @@ CheckTableModel::checkDelay(const Pvt *pvt,
 {
   ArcDelay check_delay;
   if (check_models_) {
+    TableLookup lookup;
     float margin = findValue(pvt, check_models_->model(), from_slew,
-                             to_slew, related_out_cap);
+                             to_slew, related_out_cap, lookup);
     check_delay.setMean(margin);
 
     switch (pocv_mode) {
@@ -488,7 +645,7 @@ CheckTableModel::checkDelay(const Pvt *pvt,
         std_dev_model = check_models_->sigma(min_max);
       if (std_dev_model) {
         float std_dev = findValue(pvt, std_dev_model, from_slew,
-                                  to_slew, related_out_cap);
+                                  to_slew, related_out_cap, lookup);
         check_delay.setStdDev(std_dev);
       }
       break;
@@ -496,19 +653,19 @@ CheckTableModel::checkDelay(const Pvt *pvt,
     case PocvMode::skew_normal: {
       if (check_models_->meanShift()) {
         float mean_shift = findValue(pvt, check_models_->meanShift(),
-                                     from_slew, to_slew, related_out_cap);
+                                     from_slew, to_slew, related_out_cap, lookup);
         check_delay.setMeanShift(mean_shift);
       }
         
       if (check_models_->stdDev()) {
         float std_dev = findValue(pvt, check_models_->stdDev(),
-                                  from_slew, to_slew, related_out_cap);
+                                  from_slew, to_slew, related_out_cap, lookup);
         check_delay.setStdDev(std_dev);
       }
 
       if (check_models_->skewness()) {
         float skewness = findValue(pvt, check_models_->skewness(),
-                                   from_slew, to_slew, related_out_cap);
+                                   from_slew, to_slew, related_out_cap, lookup);
         check_delay.setSkewness(skewness);
       }
       break;
@@ -537,6 +694,25 @@ CheckTableModel::findValue(const Pvt *pvt,
     return 0.0;
 }
 
+float
+CheckTableModel::findValue(const Pvt *pvt,
+                           const TableModel *model,
+                           float from_slew,
+                           float to_slew,
+                           float related_out_cap,
+                           TableLookup &lookup) const
+{
+  if (model) {
+    float axis_value1, axis_value2, axis_value3;
+    findAxisValues(from_slew, to_slew, related_out_cap, axis_value1, axis_value2,
+                   axis_value3);
+    lookup.find(model->table().get(), axis_value1, axis_value2, axis_value3);
+    return model->findValue(cell_, pvt, lookup);
+  }
+  else
+    return 0.0;
+}
+
 std::string
 CheckTableModel::reportCheckDelay(const Pvt *pvt,
                                   float from_slew,
@@ -840,6 +1016,33 @@ TableModel::findValue(const LibertyCell *cell,
       * scaleFactor(cell, pvt);
 }
 
+float
+TableModel::findValue(const LibertyCell *cell,
+                      const Pvt *pvt,
+                      const TableLookup &lookup) const
+{
+  return table_->findValue(lookup) * scaleFactor(cell, pvt);
+}
+
+void
+TableModel::findValues(const LibertyCell *cell,
+                       const Pvt *pvt,
+                       const TableLookup &lookup,
+                       std::span<const TableModel *const> models,
+                       // Return values.
+                       float *values)
+{
+  std::array<const Table *, 8> tables;
+  for (size_t i = 0; i < models.size(); i += tables.size()) {
+    size_t count = std::min(tables.size(), models.size() - i);
+    for (size_t j = 0; j < count; j++)
+      tables[j] = models[i + j]->table_.get();
+    Table::findValues(lookup, std::span(tables.data(), count), values + i);
+    for (size_t j = 0; j < count; j++)
+      values[i + j] *= models[i + j]->scaleFactor(cell, pvt);
+  }
+}
+
 float
 TableModel::scaleFactor(const LibertyCell *cell,
                         const Pvt *pvt) const
@@ -1069,53 +1272,137 @@ Table::findValue(float axis_value1,
     return value_;
   if (order_ == 1)
     return findValue(axis_value1);
+  return findValue(TableLookup(this, axis_value1, axis_value2, axis_value3));
+}
+
+float
+Table::findValue(const TableLookup &lookup) const
+{
+  if (order_ == 0)
+    return value_;
+  if (order_ == 1) {
+    if (axis1_->size() == 1)
+      return value(0);
+    size_t axis_index1 = lookup.index1();
+    double dx1 = lookup.dx1();
+    double y1 = value(axis_index1);
+    double y2 = value(axis_index1 + 1);
+    return (1 - dx1) * y1 + dx1 * y2;
+  }
   if (order_ == 2)
-    return findValueOrder2(axis_value1, axis_value2);
+    return findValueOrder2(lookup);
   else
-    return findValueOrder3(axis_value1, axis_value2, axis_value3);
+    return findValueOrder3(lookup);
+}
+
+void
+Table::findValues(size_t count,
+                  const float *axis_values1,
+                  const float *axis_values2,
+                  const float *axis_values3,
+                  // Return values.
+                  float *values) const
+{
+  if (order_ == 2 && axis1_->size() > 1 && axis2_->size() > 1) {
+    // Gather the axis positions and corners of a block of points and
+    // interpolate them together.
+    Interpolate2Block block;
+    for (size_t i = 0; i < count; i += block.size) {
+      size_t block_count = std::min(block.size, count - i);
+      for (size_t j = 0; j < block_count; j++) {
+        float x1 = axis_values1[i + j];
+        float x2 = axis_values2[i + j];
+        size_t index1 = axis1_->findAxisIndex(x1);
+        size_t index2 = axis2_->findAxisIndex(x2);
+        block.x1[j] = x1;
+        block.x1l[j] = axis1_->axisValue(index1);
+        block.x1u[j] = axis1_->axisValue(index1 + 1);
+        block.x2[j] = x2;
+        block.x2l[j] = axis2_->axisValue(index2);
+        block.x2u[j] = axis2_->axisValue(index2 + 1);
+        block.y00[j] = value(index1, index2);
+        block.y10[j] = value(index1 + 1, index2);
+        block.y11[j] = value(index1 + 1, index2 + 1);
+        block.y01[j] = value(index1, index2 + 1);
+      }
+      interpolate2(block, block_count, values + i);
+    }
+  }
+  else {
+    TableLookup lookup;
+    for (size_t i = 0; i < count; i++) {
+      lookup.find(this,
+                  axis_values1 ? axis_values1[i] : 0.0F,
+                  axis_values2 ? axis_values2[i] : 0.0F,
+                  axis_values3 ? axis_values3[i] : 0.0F);
+      values[i] = findValue(lookup);
+    }
+  }
+}
+
+void
+Table::findValues(const TableLookup &lookup,
+                  std::span<const Table *const> tables,
+                  // Return values.
+                  float *values)
+{
+  const Table *table0 = tables.empty() ? nullptr : tables[0];
+  if (table0
+      && table0->order_ == 2
+      && table0->axis1_->size() > 1
+      && table0->axis2_->size() > 1) {
+    size_t index1 = lookup.index1();
+    size_t index2 = lookup.index2();
+    double dx1 = lookup.dx1();
+    double dx2 = lookup.dx2();
+    // Same weights and summation order as findValueOrder2.
+    double w00 = (1 - dx1) * (1 - dx2);
+    double w10 = dx1 * (1 - dx2);
+    double w11 = dx1 * dx2;
+    double w01 = (1 - dx1) * dx2;
+    for (size_t i = 0; i < tables.size(); i++) {
+      const Table *table = tables[i];
+      double y00 = table->value(index1, index2);
+      double y10 = table->value(index1 + 1, index2);
+      double y11 = table->value(index1 + 1, index2 + 1);
+      double y01 = table->value(index1, index2 + 1);
+      values[i] = w00 * y00 + w10 * y10 + w11 * y11 + w01 * y01;
+    }
+  }
+  else {
+    for (size_t i = 0; i < tables.size(); i++)
+      values[i] = tables[i]->findValue(lookup);
+  }
 }
 
 float
-Table::findValueOrder2(float axis_value1,
-                       float axis_value2) const
+Table::findValueOrder2(const TableLookup &lookup) const
 {
   size_t size1 = axis1_->size();
   size_t size2 = axis2_->size();
   if (size1 == 1) {
     if (size2 == 1)
       return value(0, 0);
-    size_t axis_index2 = axis2_->findAxisIndex(axis_value2);
-    double x2 = axis_value2;
+    size_t axis_index2 = lookup.index2();
+    double dx2 = lookup.dx2();
     double y00 = value(0, axis_index2);
-    double x2l = axis2_->axisValue(axis_index2);
-    double x2u = axis2_->axisValue(axis_index2 + 1);
-    double dx2 = (x2 - x2l) / (x2u - x2l);
     double y01 = value(0, axis_index2 + 1);
     return (1 - dx2) * y00 + dx2 * y01;
   }
   if (size2 == 1) {
-    size_t axis_index1 = axis1_->findAxisIndex(axis_value1);
-    double x1 = axis_value1;
+    size_t axis_index1 = lookup.index1();
+    double dx1 = lookup.dx1();
     double y00 = value(axis_index1, 0);
-    double x1l = axis1_->axisValue(axis_index1);
-    double x1u = axis1_->axisValue(axis_index1 + 1);
-    double dx1 = (x1 - x1l) / (x1u - x1l);
     double y10 = value(axis_index1 + 1, 0);
     return (1 - dx1) * y00 + dx1 * y10;
   }
-  size_t axis_index1 = axis1_->findAxisIndex(axis_value1);
-  size_t axis_index2 = axis2_->findAxisIndex(axis_value2);
-  double x1 = axis_value1;
-  double x2 = axis_value2;
+  size_t axis_index1 = lookup.index1();
+  size_t axis_index2 = lookup.index2();
+  double dx1 = lookup.dx1();
+  double dx2 = lookup.dx2();
   double y00 = value(axis_index1, axis_index2);
-  double x1l = axis1_->axisValue(axis_index1);
-  double x1u = axis1_->axisValue(axis_index1 + 1);
-  double dx1 = (x1 - x1l) / (x1u - x1l);
   double y10 = value(axis_index1 + 1, axis_index2);
   double y11 = value(axis_index1 + 1, axis_index2 + 1);
-  double x2l = axis2_->axisValue(axis_index2);
-  double x2u = axis2_->axisValue(axis_index2 + 1);
-  double dx2 = (x2 - x2l) / (x2u - x2l);
   double y01 = value(axis_index1, axis_index2 + 1);
   return (1 - dx1) * (1 - dx2) * y00
     + dx1 * (1 - dx2) * y10
@@ -1124,19 +1411,14 @@ Table::findValueOrder2(float axis_value1,
 }
 
 float
-Table::findValueOrder3(float axis_value1,
-                       float axis_value2,
-                       float axis_value3) const
-{
-  size_t axis_index1 = axis1_->findAxisIndex(axis_value1);
-  size_t axis_index2 = axis2_->findAxisIndex(axis_value2);
-  size_t axis_index3 = axis3_->findAxisIndex(axis_value3);
-  double x1 = axis_value1;
-  double x2 = axis_value2;
-  double x3 = axis_value3;
-  double dx1 = 0.0;
-  double dx2 = 0.0;
-  double dx3 = 0.0;
+Table::findValueOrder3(const TableLookup &lookup) const
+{
+  size_t axis_index1 = lookup.index1();
+  size_t axis_index2 = lookup.index2();
+  size_t axis_index3 = lookup.index3();
+  double dx1 = lookup.dx1();
+  double dx2 = lookup.dx2();
+  double dx3 = lookup.dx3();
   double y000 = value(axis_index1, axis_index2, axis_index3);
   double y001 = 0.0;
   double y010 = 0.0;
@@ -1147,9 +1429,6 @@ Table::findValueOrder3(float axis_value1,
   double y111 = 0.0;
 
   if (axis1_->size() != 1) {
-    double x1l = axis1_->axisValue(axis_index1);
-    double x1u = axis1_->axisValue(axis_index1 + 1);
-    dx1 = (x1 - x1l) / (x1u - x1l);
     y100 = value(axis_index1 + 1, axis_index2, axis_index3);
     if (axis3_->size() != 1)
       y101 = value(axis_index1 + 1, axis_index2, axis_index3 + 1);
@@ -1160,19 +1439,12 @@ Table::findValueOrder3(float axis_value1,
     }
   }
   if (axis2_->size() != 1) {
-    double x2l = axis2_->axisValue(axis_index2);
-    double x2u = axis2_->axisValue(axis_index2 + 1);
-    dx2 = (x2 - x2l) / (x2u - x2l);
     y010 = value(axis_index1, axis_index2 + 1, axis_index3);
     if (axis3_->size() != 1)
       y011 = value(axis_index1, axis_index2 + 1, axis_index3 + 1);
   }
-  if (axis3_->size() != 1) {
-    double x3l = axis3_->axisValue(axis_index3);
-    double x3u = axis3_->axisValue(axis_index3 + 1);
-    dx3 = (x3 - x3l) / (x3u - x3l);
+  if (axis3_->size() != 1)
     y001 = value(axis_index1, axis_index2, axis_index3 + 1);
-  }
 
   return (1 - dx1) * (1 - dx2) * (1 - dx3) * y000
       + (1 - dx1) * (1 - dx2) * dx3 * y001 + (1 - dx1) * dx2 * (1 - dx3) * y010
@@ -1247,6 +1519,93 @@ Table::findValue(const LibertyLibrary *,
   return findValue(axis_value1, axis_value2, axis_value3);
 }
 
+////////////////////////////////////////////////////////////////
+
+TableLookup::TableLookup() :
+  order_(-1),
+  axis1_(nullptr),
+  axis2_(nullptr),
+  axis3_(nullptr),
+  axis_value1_(0.0),
+  axis_value2_(0.0),
+  axis_value3_(0.0),
+  index1_(0),
+  index2_(0),
+  index3_(0),
+  dx1_(0.0),
+  dx2_(0.0),
+  dx3_(0.0)
+{
+}
+
+TableLookup::TableLookup(const Table *table,
+                         float axis_value1,
+                         float axis_value2,
+                         float axis_value3) :
+  TableLookup()
+{
+  find(table, axis_value1, axis_value2, axis_value3);
+}
+
+void
+TableLookup::find(const Table *table,
+                  float axis_value1,
+                  float axis_value2,
+                  float axis_value3)
+{
+  bool same_axes = sameAxes(table);
+  if (!same_axes) {
+    order_ = table->order();
+    axis1_ = table->axis1();
+    axis2_ = table->axis2();
+    axis3_ = table->axis3();
+  }
+  if (!same_axes || axis_value1 != axis_value1_) {
+    axis_value1_ = axis_value1;
+    findAxis(axis1_, axis_value1, same_axes, index1_, dx1_);
+  }
+  if (!same_axes || axis_value2 != axis_value2_) {
+    axis_value2_ = axis_value2;
+    findAxis(axis2_, axis_value2, same_axes, index2_, dx2_);
+  }
+  if (!same_axes || axis_value3 != axis_value3_) {
+    axis_value3_ = axis_value3;
+    findAxis(axis3_, axis_value3, same_axes, index3_, dx3_);
+  }
+}
+
+bool
+TableLookup::sameAxes(const Table *table) const
+{
+  return table->order() == order_
+    && table->axis1() == axis1_
+    && table->axis2() == axis2_
+    && table->axis3() == axis3_;
+}
+
+void
+TableLookup::findAxis(const TableAxis *axis,
+                      float axis_value,
+                      bool use_hint,
+                      // Return values.
+                      size_t &index,
+                      double &dx)
+{
+  if (axis == nullptr || axis->size() <= 1) {
+    index = 0;
+    dx = 0.0;
+  }
+  else {
+    index = use_hint
+      ? axis->findAxisIndex(axis_value, index)
+      : axis->findAxisIndex(axis_value);
+    double x = axis_value;
+    double xl = axis->axisValue(index);
+    double xu = axis->axisValue(index + 1);
+    dx = (x - xl) / (xu - xl);
+  }
+}
+
 std::string
 Table::reportValue(std::string_view result_name,
                    const LibertyCell *cell,
@@ -1579,8 +1938,43 @@ appendSpaces(std::string &result,
 TableAxis::TableAxis(TableAxisVariable variable,
                      FloatSeq &&values) :
   variable_(variable),
-  values_(std::move(values))
+  values_(std::move(values)),
+  bucket_scale_(0.0)
+{
+  makeBuckets();
+}
+
+void
+TableAxis::makeBuckets()
 {
+  size_t size = values_.size();
+  if (size >= 2) {
+    float min = values_[0];
+    float max = values_[size - 1];
+    size_t bucket_count = size * buckets_per_value_;
+    float scale = bucket_count / (max - min);
+    if (max > min
+        && std::isfinite(scale)
+        && std::is_sorted(values_.begin(), values_.end())) {
+      bucket_scale_ = scale;
+      bucket_indices_.resize(bucket_count);
+      // The values before a bucket are all less than the values in it,
+      // so the search can start at the last of them.
+      size_t index = 0;
+      for (size_t b = 0; b < bucket_count; b++) {
+        while (index + 1 < size && bucket(values_[index + 1]) < b)
+          index++;
+        bucket_indices_[b] = index;
+      }
+    }
+  }
+}
+
+size_t
+TableAxis::bucket(float value) const
+{
+  size_t b = static_cast<size_t>((value - values_[0]) * bucket_scale_);
+  return std::min(b, bucket_indices_.size() - 1);
 }
 
 float
@@ -1612,7 +2006,34 @@ TableAxis::inBounds(float value) const
 size_t
 TableAxis::findAxisIndex(float value) const
 {
-  return findValueIndex(value, &values_);
+  if (bucket_indices_.empty() || std::isnan(value))
+    return findValueIndex(value, &values_);
+  size_t size = values_.size();
+  if (value <= values_[0])
+    return 0;
+  else if (value >= values_[size - 1])
+    return size - 2;
+  else {
+    size_t index = bucket_indices_[bucket(value)];
+    while (values_[index + 1] <= value)
+      index++;
+    return index;
+  }
+}
+
+size_t
+TableAxis::findAxisIndex(float value,
+                         size_t hint) const
+{
+  size_t size = values_.size();
+  if (!bucket_indices_.empty()
+      && hint + 1 < size
+      && value > values_[0]
+      && value < values_[size - 1]
+      && value >= values_[hint]
+      && value < values_[hint + 1])
+    return hint;
+  return findAxisIndex(value);
 }
 
 // Bisection search.
@@ -2212,13 +2633,12 @@ Table
 DriverWaveform::waveform(float slew)
 {
   const TableAxis *volt_axis = waveforms_->axis2();
-  FloatSeq *time_values = new FloatSeq;
-  FloatSeq *volt_values = new FloatSeq;
-  for (float volt : volt_axis->values()) {
-    float time = waveforms_->findValue(slew, volt, 0.0);
-    time_values->push_back(time);
-    volt_values->push_back(volt);
-  }
+  size_t volt_count = volt_axis->size();
+  FloatSeq *time_values = new FloatSeq(volt_count);
+  FloatSeq *volt_values = new FloatSeq(volt_axis->values());
+  FloatSeq slews(volt_count, slew);
+  waveforms_->findValues(volt_count, slews.data(), volt_values->data(), nullptr,
+                         time_values->data());
   TableAxisPtr time_axis =
       std::make_shared<TableAxis>(TableAxisVariable::time, std::move(*time_values));
   delete time_values;
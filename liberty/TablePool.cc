@@ -0,0 +1,235 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "TablePool.hh"
+
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "Hash.hh"
+#include "Mutex.hh"
+#include "TableModel.hh"
+
+namespace sta {
+
+static size_t
+floatsHash(size_t hash,
+           const FloatSeq &values);
+static bool
+floatsEqual(const FloatSeq &values1,
+            const FloatSeq &values2);
+
+template <class OBJ>
+using TablePoolMap = std::unordered_multimap<size_t,
+                                             std::pair<const OBJ*, std::weak_ptr<OBJ>>>;
+
+class TablePoolEntries
+{
+public:
+  TablePoolMap<TableAxis> axes_;
+  TablePoolMap<Table> tables_;
+  std::mutex lock_;
+};
+
+// Return the pooled object equal to obj, or add obj to the pool.
+// Pooled objects are owned by a deleter that removes their entry when
+// the last reference to them is dropped.
+// Entries whose deleter is waiting for the lock are still alive, so they
+// can be compared without taking a reference that could be the last one
+// dropped while the lock is held.
+template <class OBJ, class EQUAL>
+static std::shared_ptr<OBJ>
+sharePooled(std::shared_ptr<OBJ> obj,
+            size_t hash,
+            TablePoolMap<OBJ> &pool_map,
+            const std::shared_ptr<TablePoolEntries> &entries,
+            EQUAL equal,
+            size_t &shared_count)
+{
+  std::shared_ptr<OBJ> shared;
+  LockGuard lock(entries->lock_);
+  auto [begin, end] = pool_map.equal_range(hash);
+  for (auto itr = begin; itr != end; itr++) {
+    auto &[pooled, pooled_weak] = itr->second;
+    if (equal(pooled, obj.get())) {
+      shared = pooled_weak.lock();
+      if (shared) {
+        shared_count++;
+        return shared;
+      }
+    }
+  }
+  TablePoolMap<OBJ> *pool_map_ptr = &pool_map;
+  auto deleter = [entries, pool_map_ptr, hash, obj] (OBJ *ptr) mutable {
+    {
+      LockGuard lock(entries->lock_);
+      auto [begin, end] = pool_map_ptr->equal_range(hash);
+      for (auto itr = begin; itr != end; itr++) {
+        if (itr->second.first == ptr) {
+          pool_map_ptr->erase(itr);
+          break;
+        }
+      }
+    }
+    obj.reset();
+  };
+  shared = std::shared_ptr<OBJ>(obj.get(), deleter);
+  pool_map.emplace(hash, std::make_pair(shared.get(), std::weak_ptr<OBJ>(shared)));
+  return shared;
+}
+
+TablePool::TablePool() :
+  entries_(std::make_shared<TablePoolEntries>())
+{
+}
+
+TableAxisPtr
+TablePool::shareAxis(TableAxisPtr axis)
+{
+  size_t hash = axisHash(axis.get());
+  return sharePooled(std::move(axis), hash, entries_->axes_, entries_,
+                     axisEqual, shared_axis_count_);
+}
+
+TablePtr
+TablePool::shareTable(TablePtr table)
+{
+  size_t hash = tableHash(table.get());
+  return sharePooled(std::move(table), hash, entries_->tables_, entries_,
+                     tableEqual, shared_table_count_);
+}
+
+size_t
+TablePool::axisCount() const
+{
+  LockGuard lock(entries_->lock_);
+  return entries_->axes_.size();
+}
+
+size_t
+TablePool::tableCount() const
+{
+  LockGuard lock(entries_->lock_);
+  return entries_->tables_.size();
+}
+
+size_t
+TablePool::axisHash(const TableAxis *axis)
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, static_cast<size_t>(axis->variable()));
+  return floatsHash(hash, axis->values());
+}
+
+bool
+TablePool::axisEqual(const TableAxis *axis1,
+                     const TableAxis *axis2)
+{
+  return axis1->variable() == axis2->variable()
+    && floatsEqual(axis1->values(), axis2->values());
+}
+
+// Axes are shared before the tables that use them, so they are
+// compared by pointer.
+size_t
+TablePool::tableHash(const Table *table)
+{
+  size_t hash = hash_init_value;
+  hashIncr(hash, table->order());
+  hashIncr(hash, std::hash<const TableAxis*>()(table->axis1()));
+  hashIncr(hash, std::hash<const TableAxis*>()(table->axis2()));
+  hashIncr(hash, std::hash<const TableAxis*>()(table->axis3()));
+  switch (table->order()) {
+  case 0:
+    hashIncr(hash, std::bit_cast<uint32_t>(table->value(0)));
+    break;
+  case 1:
+    hash = floatsHash(hash, *table->values());
+    break;
+  default:
+    for (const FloatSeq &row : *table->values3())
+      hash = floatsHash(hash, row);
+    break;
+  }
+  return hash;
+}
+
+bool
+TablePool::tableEqual(const Table *table1,
+                      const Table *table2)
+{
+  if (table1->order() != table2->order()
+      || table1->axis1() != table2->axis1()
+      || table1->axis2() != table2->axis2()
+      || table1->axis3() != table2->axis3())
+    return false;
+  switch (table1->order()) {
+  case 0:
+    return std::bit_cast<uint32_t>(table1->value(0))
+      == std::bit_cast<uint32_t>(table2->value(0));
+  case 1:
+    return floatsEqual(*table1->values(), *table2->values());
+  default: {
+    const FloatTable *values1 = table1->values3();
+    const FloatTable *values2 = table2->values3();
+    if (values1->size() != values2->size())
+      return false;
+    for (size_t i = 0; i < values1->size(); i++) {
+      if (!floatsEqual((*values1)[i], (*values2)[i]))
+        return false;
+    }
+    return true;
+  }
+  }
+}
+
+// Floats are hashed and compared by bits so shared tables give
+// bit-identical results.
+static size_t
+floatsHash(size_t hash,
+           const FloatSeq &values)
+{
+  hashIncr(hash, values.size());
+  for (float value : values)
+    hashIncr(hash, std::bit_cast<uint32_t>(value));
+  return hash;
+}
+
+static bool
+floatsEqual(const FloatSeq &values1,
+            const FloatSeq &values2)
+{
+  if (values1.size() != values2.size())
+    return false;
+  for (size_t i = 0; i < values1.size(); i++) {
+    if (std::bit_cast<uint32_t>(values1[i]) != std::bit_cast<uint32_t>(values2[i]))
+      return false;
+  }
+  return true;
+}
+
+} // namespace sta
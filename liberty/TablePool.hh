@@ -0,0 +1,72 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "LibertyClass.hh"
+
+namespace sta {
+
+// Shares identical table axes and tables between the liberty libraries
+// read in a session. Entries are found by a hash of their contents and
+// compared to resolve collisions. The pool only holds weak references,
+// so tables are deleted with the last library that uses them and
+// their entries are removed from the pool when they are deleted.
+// Tables that are modified after they are read must not be shared.
+class TablePoolEntries;
+
+class TablePool
+{
+public:
+  TablePool();
+  // Return a shared axis with the same values as axis.
+  TableAxisPtr shareAxis(TableAxisPtr axis);
+  // Return a shared table with the same axes and values as table.
+  // The table axes should already be shared.
+  TablePtr shareTable(TablePtr table);
+  size_t sharedAxisCount() const { return shared_axis_count_; }
+  size_t sharedTableCount() const { return shared_table_count_; }
+  // Number of axes and tables in the pool.
+  size_t axisCount() const;
+  size_t tableCount() const;
+
+private:
+  static size_t axisHash(const TableAxis *axis);
+  static size_t tableHash(const Table *table);
+  static bool axisEqual(const TableAxis *axis1,
+                        const TableAxis *axis2);
+  static bool tableEqual(const Table *table1,
+                         const Table *table2);
+
+  // Shared with the deleters of the pooled axes and tables so the
+  // entries outlive the pool.
+  std::shared_ptr<TablePoolEntries> entries_;
+  size_t shared_axis_count_{0};
+  size_t shared_table_count_{0};
+};
+
+} // namespace sta
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <map>
+#include <shared_mutex>
 #include <string_view>
 
 #include "ConcreteLibrary.hh"
@@ -290,6 +291,18 @@ ConcreteNetwork::clearImpl()
   deleteCellNetworkViewsImpl();
   deleteContents(library_seq_);
   library_map_.clear();
+  // Free the blocks unless objects that are not in the hierarchy are
+  // still around.
+  if (instance_pool_.size() == 0
+      && net_pool_.size() == 0
+      && pin_pool_.size() == 0
+      && term_pool_.size() == 0) {
+    instance_pool_.clear();
+    net_pool_.clear();
+    pin_pool_.clear();
+    term_pool_.clear();
+    name_pool_.clear();
+  }
 }
 
 void
@@ -724,6 +737,96 @@ ConcreteNetwork::nextObjectId()
 
 ////////////////////////////////////////////////////////////////
 
+// Instance map and pin array sizes found by walking the hierarchy.
+class ConcreteInstanceMemory
+{
+public:
+  size_t child_maps{0};
+  size_t child_entries{0};
+  size_t net_maps{0};
+  size_t net_entries{0};
+  size_t attribute_maps{0};
+  size_t attribute_entries{0};
+  size_t pin_entries{0};
+};
+
+void
+ConcreteNetwork::findInstanceMemory(const ConcreteInstance *inst,
+                                    ConcreteInstanceMemory &memory) const
+{
+  memory.pin_entries += inst->pins_.capacity();
+  if (inst->nets_) {
+    memory.net_maps++;
+    memory.net_entries += inst->nets_->size();
+  }
+  if (inst->attribute_map_) {
+    memory.attribute_maps++;
+    memory.attribute_entries += inst->attribute_map_->size();
+  }
+  if (inst->children_) {
+    memory.child_maps++;
+    memory.child_entries += inst->children_->size();
+    for (const auto &[name, child] : *inst->children_)
+      findInstanceMemory(child, memory);
+  }
+}
+
+template <class TYPE>
+static void
+reportObjectPool(std::string_view name,
+                 const ObjectPool<TYPE> &pool,
+                 Report *report)
+{
+  constexpr double mbyte = 1024.0 * 1024.0;
+  report->report(" {:<14} {:10} {:8.1f}MB allocated {:8.1f}MB",
+                 name, pool.size(),
+                 pool.size() * sizeof(TYPE) / mbyte,
+                 pool.capacity() * sizeof(TYPE) / mbyte);
+}
+
+void
+ConcreteNetwork::reportMemory() const
+{
+  constexpr double mbyte = 1024.0 * 1024.0;
+  // Red-black tree node overhead (color, parent, left, right).
+  constexpr size_t map_node_bytes = 32;
+  report_->report("Network memory");
+  reportObjectPool("instances", instance_pool_, report_);
+  reportObjectPool("nets", net_pool_, report_);
+  reportObjectPool("pins", pin_pool_, report_);
+  reportObjectPool("terms", term_pool_, report_);
+  report_->report(" {:<14} {:10} {:8.1f}MB allocated {:8.1f}MB",
+                  "names", name_pool_.size(),
+                  name_pool_.charBytes() / mbyte,
+                  name_pool_.allocatedBytes() / mbyte);
+
+  ConcreteInstanceMemory memory;
+  const ConcreteInstance *top_inst =
+    reinterpret_cast<const ConcreteInstance*>(top_instance_);
+  if (top_inst)
+    findInstanceMemory(top_inst, memory);
+  size_t child_bytes = memory.child_entries
+    * (map_node_bytes + sizeof(ConcreteInstanceChildMap::value_type));
+  size_t net_bytes = memory.net_entries
+    * (map_node_bytes + sizeof(ConcreteInstanceNetMap::value_type));
+  size_t attr_bytes = memory.attribute_entries
+    * (map_node_bytes + sizeof(AttributeMap::value_type));
+  report_->report(" {:<14} {:10} {:8.1f}MB entries {:10}",
+                  "child maps", memory.child_maps, child_bytes / mbyte,
+                  memory.child_entries);
+  report_->report(" {:<14} {:10} {:8.1f}MB entries {:10}",
+                  "net maps", memory.net_maps, net_bytes / mbyte,
+                  memory.net_entries);
+  report_->report(" {:<14} {:10} {:8.1f}MB entries {:10}",
+                  "attribute maps", memory.attribute_maps, attr_bytes / mbyte,
+                  memory.attribute_entries);
+  report_->report(" {:<14} {:10} {:8.1f}MB",
+                  "pin arrays", memory.pin_entries,
+                  memory.pin_entries * sizeof(ConcretePin*) / mbyte);
+}
+
+////////////////////////////////////////////////////////////////
+
 class ConcreteCellPortIterator1 : public CellPortIterator
 {
 public:
@@ -1080,6 +1183,38 @@ ConcreteNetwork::pinIterator(const Instance *instance) const
   return new ConcreteInstancePinIterator(inst, pin_count);
 }
 
+void
+ConcreteNetwork::visitChildren(const Instance *instance,
+                               NetworkInstanceVisitor &visitor) const
+{
+  const ConcreteInstance *inst =
+    reinterpret_cast<const ConcreteInstance*>(instance);
+  if (inst->children_) {
+    NetworkVisitorBatch<Instance*> batch(visitor);
+    for (const auto &[name, child] : *inst->children_)
+      batch.add(reinterpret_cast<Instance*>(child));
+    batch.flush();
+  }
+}
+
+// Skip over missing pins like ConcreteInstancePinIterator.
+void
+ConcreteNetwork::visitPins(const Instance *instance,
+                           NetworkPinVisitor &visitor) const
+{
+  const ConcreteInstance *inst =
+    reinterpret_cast<const ConcreteInstance*>(instance);
+  ConcreteCell *cell = reinterpret_cast<ConcreteCell*>(inst->cell());
+  int pin_count = cell->portBitCount();
+  NetworkVisitorBatch<Pin*> batch(visitor);
+  for (int pin_index = 0; pin_index < pin_count; pin_index++) {
+    ConcretePin *pin = inst->pins_[pin_index];
+    if (pin)
+      batch.add(reinterpret_cast<Pin*>(pin));
+  }
+  batch.flush();
+}
+
 InstanceNetIterator *
 ConcreteNetwork::netIterator(const Instance *instance) const
 {
@@ -1220,6 +1355,37 @@ ConcreteNetwork::termIterator(const Net *net) const
   return new ConcreteNetTermIterator(cnet);
 }
 
+void
+ConcreteNetwork::visitPins(const Net *net,
+                           NetworkNetPinVisitor &visitor) const
+{
+  const ConcreteNet *cnet = reinterpret_cast<const ConcreteNet*>(net);
+  NetworkVisitorBatch<const Pin*> batch(visitor);
+  ConcretePin *pin = cnet->pins_;
+  while (pin) {
+    // Find the next pin before adding may call the visitor.
+    ConcretePin *next_pin = pin->net_next_;
+    batch.add(reinterpret_cast<Pin*>(pin));
+    pin = next_pin;
+  }
+  batch.flush();
+}
+
+void
+ConcreteNetwork::visitTerms(const Net *net,
+                            NetworkTermVisitor &visitor) const
+{
+  const ConcreteNet *cnet = reinterpret_cast<const ConcreteNet*>(net);
+  NetworkVisitorBatch<Term*> batch(visitor);
+  ConcreteTerm *term = cnet->terms_;
+  while (term) {
+    ConcreteTerm *next_term = term->net_next_;
+    batch.add(reinterpret_cast<Term*>(term));
+    term = next_term;
+  }
+  batch.flush();
+}
+
 void
 ConcreteNetwork::mergeInto(Net *net,
                            Net *into_net)
@@ -1269,7 +1435,8 @@ ConcreteNetwork::makeConcreteInstance(ConcreteCell *cell,
 {
   ConcreteInstance *cparent =
     reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteInstance *inst = new ConcreteInstance(name, cell, cparent);
+  ConcreteInstance *inst = instance_pool_.make(name_pool_.intern(name),
+                                                cell, cparent);
   if (parent)
     cparent->addChild(inst);
   return reinterpret_cast<Instance*>(inst);
@@ -1332,7 +1499,7 @@ ConcreteNetwork::deleteInstanceImpl(Instance *inst)
       NetTermIterator *term_iter = termIterator(net);
       while (term_iter->hasNext()) {
         ConcreteTerm *term = reinterpret_cast<ConcreteTerm*>(term_iter->next());
-        delete term;
+        term_pool_.destroy(term);
       }
       delete term_iter;
       itr = nets->erase(itr);
@@ -1361,7 +1528,8 @@ ConcreteNetwork::deleteInstanceImpl(Instance *inst)
       reinterpret_cast<ConcreteInstance*>(parent_inst);
     cparent->deleteChild(cinst);
   }
-  delete cinst;
+  name_pool_.release(cinst->name_);
+  instance_pool_.destroy(cinst);
 }
 
 Pin *
@@ -1372,7 +1540,7 @@ ConcreteNetwork::makePin(Instance *inst,
   ConcreteInstance *cinst = reinterpret_cast<ConcreteInstance*>(inst);
   ConcretePort *cport = reinterpret_cast<ConcretePort*>(port);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcretePin *cpin = new ConcretePin(cinst, cport, cnet);
+  ConcretePin *cpin = pin_pool_.make(cinst, cport, cnet);
   cinst->addPin(cpin);
   if (cnet)
     connectNetPin(cnet, cpin);
@@ -1385,7 +1553,7 @@ ConcreteNetwork::makeTerm(Pin *pin,
 {
   ConcretePin *cpin = reinterpret_cast<ConcretePin*>(pin);
   ConcreteNet *cnet = reinterpret_cast<ConcreteNet*>(net);
-  ConcreteTerm *cterm = new ConcreteTerm(cpin, cnet);
+  ConcreteTerm *cterm = term_pool_.make(cpin, cnet);
   if (cnet)
     cnet->addTerm(cterm);
   cpin->term_ = cterm;
@@ -1427,13 +1595,13 @@ ConcreteNetwork::connect(Instance *inst,
   else if (cport->isBus() || cport->isBundle())
     report()->warn(2728, "port {} has no pin to connect.", cport->name());
   else {
-    cpin = new ConcretePin(cinst, cport, cnet);
+    cpin = pin_pool_.make(cinst, cport, cnet);
     cinst->addPin(cpin);
   }
   if (cpin) {
     if (inst == top_instance_) {
       // makeTerm
-      ConcreteTerm *cterm = new ConcreteTerm(cpin, cnet);
+      ConcreteTerm *cterm = term_pool_.make(cpin, cnet);
       if (cnet)
         cnet->addTerm(cterm);
       cpin->term_ = cterm;
@@ -1459,6 +1627,7 @@ ConcreteNetwork::connectNetPin(ConcreteNet *cnet,
   if (isDriver(pin)) {
     if (cnet->terms_ == nullptr) {
       Net *net = reinterpret_cast<Net*>(cnet);
+      std::unique_lock lock(net_drvr_pin_map_lock_);
       PinSet *drvrs = findKey(net_drvr_pin_map_, net);
       if (drvrs)
         drvrs->insert(pin);
@@ -1481,7 +1650,7 @@ ConcreteNetwork::disconnectPin(Pin *pin)
         clearNetDrvrPinMap();
       }
       cpin->term_ = nullptr;
-      delete cterm;
+      term_pool_.destroy(cterm);
     }
   }
   else {
@@ -1505,6 +1674,7 @@ ConcreteNetwork::disconnectNetPin(ConcreteNet *cnet,
     // and it is safe to incrementally update the drivers.
     if (cnet->terms_ == nullptr) {
       Net *net = reinterpret_cast<Net*>(cnet);
+      std::unique_lock lock(net_drvr_pin_map_lock_);
       PinSet *drvrs = findKey(net_drvr_pin_map_, net);
       if (drvrs)
         drvrs->erase(pin);
@@ -1524,7 +1694,7 @@ ConcreteNetwork::deletePin(Pin *pin)
   ConcreteInstance *cinst = cpin->instance();
   if (cinst)
     cinst->deletePin(cpin);
-  delete cpin;
+  pin_pool_.destroy(cpin);
 }
 
 Net *
@@ -1532,7 +1702,7 @@ ConcreteNetwork::makeNet(std::string_view name,
                          Instance *parent)
 {
   ConcreteInstance *cparent = reinterpret_cast<ConcreteInstance*>(parent);
-  ConcreteNet *net = new ConcreteNet(name, cparent);
+  ConcreteNet *net = net_pool_.make(name_pool_.intern(name), cparent);
   cparent->addNet(net);
   return reinterpret_cast<Net*>(net);
 }
@@ -1551,15 +1721,19 @@ ConcreteNetwork::deleteNet(Net *net)
 
   constant_nets_[static_cast<int>(LogicValue::zero)].erase(net);
   constant_nets_[static_cast<int>(LogicValue::one)].erase(net);
-  PinSet *drvrs = findKey(net_drvr_pin_map_, net);
-  if (drvrs) {
-    delete drvrs;
-    net_drvr_pin_map_.erase(net);
+  {
+    std::unique_lock lock(net_drvr_pin_map_lock_);
+    PinSet *drvrs = findKey(net_drvr_pin_map_, net);
+    if (drvrs) {
+      delete drvrs;
+      net_drvr_pin_map_.erase(net);
+    }
   }
 
   ConcreteInstance *cinst = cnet->instance();
   cinst->deleteNet(cnet);
-  delete cnet;
+  name_pool_.release(cnet->name_);
+  net_pool_.destroy(cnet);
 }
 
 void
@@ -1626,13 +1800,13 @@ ConcreteNetwork::visitConnectedPins(const Net *net,
 
 ////////////////////////////////////////////////////////////////
 
-ConcreteInstance::ConcreteInstance(std::string_view name,
+ConcreteInstance::ConcreteInstance(const char *name,
                                    ConcreteCell *cell,
                                    ConcreteInstance *parent) :
   name_(name),
-  id_(ConcreteNetwork::nextObjectId()),
   cell_(cell),
-  parent_(parent)
+  parent_(parent),
+  id_(ConcreteNetwork::nextObjectId())
 {
   initPins();
 }
@@ -1648,6 +1822,7 @@ ConcreteInstance::~ConcreteInstance()
 {
   delete children_;
   delete nets_;
+  delete attribute_map_;
 }
 
 Instance *
@@ -1729,18 +1904,32 @@ void
 ConcreteInstance::setAttribute(std::string_view key,
                                std::string_view value)
 {
-  attribute_map_[std::string(key)] = value;
+  if (attribute_map_ == nullptr)
+    attribute_map_ = new AttributeMap;
+  (*attribute_map_)[std::string(key)] = value;
 }
 
 std::string
 ConcreteInstance::getAttribute(std::string_view key) const
 {
-  const auto &itr = attribute_map_.find(key);
-  if (itr != attribute_map_.end())
-    return itr->second;
+  if (attribute_map_) {
+    const auto &itr = attribute_map_->find(key);
+    if (itr != attribute_map_->end())
+      return itr->second;
+  }
   return "";
 }
 
+const AttributeMap &
+ConcreteInstance::attributeMap() const
+{
+  static const AttributeMap empty_map;
+  if (attribute_map_)
+    return *attribute_map_;
+  else
+    return empty_map;
+}
+
 void
 ConcreteInstance::addChild(ConcreteInstance *child)
 {
@@ -1848,11 +2037,11 @@ ConcreteTerm::ConcreteTerm(ConcretePin *pin,
 
 ////////////////////////////////////////////////////////////////
 
-ConcreteNet::ConcreteNet(std::string_view name,
+ConcreteNet::ConcreteNet(const char *name,
                          ConcreteInstance *instance) :
   name_(name),
-  id_(ConcreteNetwork::nextObjectId()),
-  instance_(instance)
+  instance_(instance),
+  id_(ConcreteNetwork::nextObjectId())
 {
 }
 
@@ -121,9 +121,7 @@ visitPinsAboveNet2(const Pin *hpin,
 {
   visited.insert(above_net);
   // Visit above net pins.
-  NetPinIterator *pin_iter = network->pinIterator(above_net);
-  while (pin_iter->hasNext()) {
-    const Pin *above_pin = pin_iter->next();
+  network->visitPins(above_net, [&](const Pin *above_pin) {
     if (above_pin != hpin) {
       if (network->isDriver(above_pin)) {
         HpinDrvrLoad *drvr = new HpinDrvrLoad(above_pin, nullptr,
@@ -147,13 +145,10 @@ visitPinsAboveNet2(const Pin *hpin,
         }
       }
     }
-  }
-  delete pin_iter;
+  });
 
   // Search up from net terminals.
-  NetTermIterator *term_iter = network->termIterator(above_net);
-  while (term_iter->hasNext()) {
-    Term *term = term_iter->next();
+  network->visitTerms(above_net, [&](const Term *term) {
     Pin *above_pin = network->pin(term);
     if (above_pin 
         && above_pin != hpin) {
@@ -177,8 +172,7 @@ visitPinsAboveNet2(const Pin *hpin,
         above_loads.insert(load);
       }
     }
-  }
-  delete term_iter;
+  });
 }
 
 static void
@@ -193,9 +187,7 @@ visitPinsBelowNet2(const Pin *hpin,
 {
   visited.insert(below_net);
   // Visit below net pins.
-  NetPinIterator *pin_iter = network->pinIterator(below_net);
-  while (pin_iter->hasNext()) {
-    const Pin *below_pin = pin_iter->next();
+  network->visitPins(below_net, [&](const Pin *below_pin) {
     if (below_pin != hpin) {
       if (above_net && !visited.contains(above_net))
         visitPinsAboveNet2(below_pin, above_net,
@@ -225,13 +217,10 @@ visitPinsBelowNet2(const Pin *hpin,
         }
       }
     }
-  }
-  delete pin_iter;
+  });
 
   // Search up from net terminals.
-  NetTermIterator *term_iter = network->termIterator(below_net);
-  while (term_iter->hasNext()) {
-    Term *term = term_iter->next();
+  network->visitTerms(below_net, [&](const Term *term) {
     Pin *above_pin = network->pin(term);
     if (above_pin
         && above_pin != hpin) {
@@ -244,8 +233,7 @@ visitPinsBelowNet2(const Pin *hpin,
         hpin_path->erase(above_pin);
       }
     }
-  }
-  delete term_iter;
+  });
 }
 
 static void
@@ -33,6 +33,7 @@
 
 #include <compare>
 #include <set>
+#include <shared_mutex>
 
 #include "ContainerHelpers.hh"
 #include "Liberty.hh"
@@ -58,6 +59,12 @@ Network::clear()
   generated_clock_pins_to_cells_.clear();
 }
 
+void
+Network::reportMemory() const
+{
+  report_->warn(2729, "network memory reporting is not supported.");
+}
+
 bool
 Network::isLinked() const
 {
@@ -1453,6 +1460,56 @@ Network::leafInstanceIterator(const Instance *hier_inst) const
 
 ////////////////////////////////////////////////////////////////
 
+void
+Network::visitChildren(const Instance *instance,
+                       NetworkInstanceVisitor &visitor) const
+{
+  NetworkVisitorBatch<Instance*> batch(visitor);
+  InstanceChildIterator *child_iter = childIterator(instance);
+  while (child_iter->hasNext())
+    batch.add(child_iter->next());
+  delete child_iter;
+  batch.flush();
+}
+
+void
+Network::visitPins(const Instance *instance,
+                   NetworkPinVisitor &visitor) const
+{
+  NetworkVisitorBatch<Pin*> batch(visitor);
+  InstancePinIterator *pin_iter = pinIterator(instance);
+  while (pin_iter->hasNext())
+    batch.add(pin_iter->next());
+  delete pin_iter;
+  batch.flush();
+}
+
+void
+Network::visitPins(const Net *net,
+                   NetworkNetPinVisitor &visitor) const
+{
+  NetworkVisitorBatch<const Pin*> batch(visitor);
+  NetPinIterator *pin_iter = pinIterator(net);
+  while (pin_iter->hasNext())
+    batch.add(pin_iter->next());
+  delete pin_iter;
+  batch.flush();
+}
+
+void
+Network::visitTerms(const Net *net,
+                    NetworkTermVisitor &visitor) const
+{
+  NetworkVisitorBatch<Term*> batch(visitor);
+  NetTermIterator *term_iter = termIterator(net);
+  while (term_iter->hasNext())
+    batch.add(term_iter->next());
+  delete term_iter;
+  batch.flush();
+}
+
+////////////////////////////////////////////////////////////////
+
 void
 Network::visitConnectedPins(const Pin *pin,
                             PinVisitor &visitor) const
@@ -1490,9 +1547,7 @@ Network::visitConnectedPins(const Net *net,
   if (!visited_nets.contains(net)) {
     visited_nets.insert(net);
     // Search up from net terminals.
-    NetTermIterator *term_iter = termIterator(net);
-    while (term_iter->hasNext()) {
-      Term *term = term_iter->next();
+    visitTerms(net, [&](Term *term) {
       Pin *above_pin = pin(term);
       if (above_pin) {
         Net *above_net = this->net(above_pin);
@@ -1501,13 +1556,10 @@ Network::visitConnectedPins(const Net *net,
         else
           visitor(above_pin);
       }
-    }
-    delete term_iter;
+    });
 
     // Search down from net pins.
-    NetPinIterator *pin_iter = pinIterator(net);
-    while (pin_iter->hasNext()) {
-      const Pin *pin = pin_iter->next();
+    visitPins(net, [&](const Pin *pin) {
       visitor(pin);
       Term *below_term = term(pin);
       if (below_term) {
@@ -1515,8 +1567,7 @@ Network::visitConnectedPins(const Net *net,
         if (below_net)
           visitConnectedPins(below_net, visitor, visited_nets);
       }
-    }
-    delete pin_iter;
+    });
   }
 }
 
@@ -1768,18 +1819,30 @@ Network::drivers(const Pin *pin)
 void
 Network::clearNetDrvrPinMap()
 {
+  std::unique_lock lock(net_drvr_pin_map_lock_);
   deleteContents(net_drvr_pin_map_);
 }
 
 PinSet *
 Network::drivers(const Net *net)
 {
-  PinSet *drvrs = findKey(net_drvr_pin_map_, net);
-  if (drvrs == nullptr) {
-    drvrs = new PinSet(this);
-    FindDrvrPins visitor(drvrs, this);
-    visitConnectedPins(net, visitor);
-    net_drvr_pin_map_[net] = drvrs;
+  {
+    std::shared_lock lock(net_drvr_pin_map_lock_);
+    PinSet *drvrs = findKey(net_drvr_pin_map_, net);
+    if (drvrs)
+      return drvrs;
+  }
+  // Find the drivers without holding the lock so other threads are not
+  // blocked while the connected pins are visited.
+  PinSet *drvrs = new PinSet(this);
+  FindDrvrPins visitor(drvrs, this);
+  visitConnectedPins(net, visitor);
+  std::unique_lock lock(net_drvr_pin_map_lock_);
+  auto [itr, inserted] = net_drvr_pin_map_.try_emplace(net, drvrs);
+  if (!inserted) {
+    // Another thread found them first.
+    delete drvrs;
+    drvrs = itr->second;
   }
   return drvrs;
 }
@@ -1926,9 +1989,7 @@ visitPinsAboveNet1(const Pin *hpin,
 {
   visited.insert(above_net);
   // Visit above net pins.
-  NetPinIterator *pin_iter = network->pinIterator(above_net);
-  while (pin_iter->hasNext()) {
-    const Pin *above_pin = pin_iter->next();
+  network->visitPins(above_net, [&](const Pin *above_pin) {
     if (above_pin != hpin) {
       if (network->isDriver(above_pin))
         above_drvrs.insert(above_pin);
@@ -1942,13 +2003,10 @@ visitPinsAboveNet1(const Pin *hpin,
                              above_drvrs, above_loads, network);
       }
     }
-  }
-  delete pin_iter;
+  });
 
   // Search up from net terminals.
-  NetTermIterator *term_iter = network->termIterator(above_net);
-  while (term_iter->hasNext()) {
-    Term *term = term_iter->next();
+  network->visitTerms(above_net, [&](const Term *term) {
     Pin *above_pin = network->pin(term);
     if (above_pin
         && above_pin != hpin) {
@@ -1961,8 +2019,7 @@ visitPinsAboveNet1(const Pin *hpin,
       if (network->isLoad(above_pin))
         above_loads.insert(above_pin);
     }
-  }
-  delete term_iter;
+  });
 }
 
 static void
@@ -1975,9 +2032,7 @@ visitPinsBelowNet1(const Pin *hpin,
 {
   visited.insert(below_net);
   // Visit below net pins.
-  NetPinIterator *pin_iter = network->pinIterator(below_net);
-  while (pin_iter->hasNext()) {
-    const Pin *below_pin = pin_iter->next();
+  network->visitPins(below_net, [&](const Pin *below_pin) {
     if (below_pin != hpin) {
       NetSet visited_above(network);
       if (network->isDriver(below_pin))
@@ -1994,8 +2049,7 @@ visitPinsBelowNet1(const Pin *hpin,
         }
       }
     }
-  }
-  delete pin_iter;
+  });
 }
 
 static void
@@ -2049,9 +2103,7 @@ visitDrvrLoadsThruNet(const Net *net,
   PinSet below_loads(network);
   PinSet net_drvrs(network);
   PinSet net_loads(network);
-  NetPinIterator *pin_iter = network->pinIterator(net);
-  while (pin_iter->hasNext()) {
-    const Pin *pin = pin_iter->next();
+  network->visitPins(net, [&](const Pin *pin) {
     if (network->isHierarchical(pin)) {
       // Search down from pin terminal.
       const Term *term = network->term(pin);
@@ -2069,12 +2121,9 @@ visitDrvrLoadsThruNet(const Net *net,
       if (network->isLoad(pin))
         net_loads.insert(pin);
     }
-  }
-  delete pin_iter;
+  });
 
-  NetTermIterator *term_iter = network->termIterator(net);
-  while (term_iter->hasNext()) {
-    Term *term = term_iter->next();
+  network->visitTerms(net, [&](const Term *term) {
     Pin *above_pin = network->pin(term);
     if (above_pin) {
       if (network->isDriver(above_pin))
@@ -2086,8 +2135,7 @@ visitDrvrLoadsThruNet(const Net *net,
         visitPinsAboveNet1(above_pin, above_net, visited,
                            above_drvrs, above_loads, network);
     }
-  }
-  delete term_iter;
+  });
   visitDrvrLoads(above_drvrs, below_loads, visitor);
   visitDrvrLoads(above_drvrs, net_loads, visitor);
   visitDrvrLoads(below_drvrs, above_loads, visitor);
@@ -224,6 +224,13 @@ network_leaf_pin_count()
   return network->leafPinCount();
 }
 
+void
+report_network_memory_cmd()
+{
+  Network *network = Sta::sta()->ensureLinked();
+  network->reportMemory();
+}
+
 Library *
 find_library(const char *name)
 {
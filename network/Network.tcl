@@ -146,6 +146,16 @@ proc instance_sorted_children { instance } {
 
 ################################################################
 
+define_cmd_args "report_network_memory" {[> filename] [>> filename]} \
+  -help {The `report_network_memory` command reports the memory used by the network instances, nets, pins, terminals, interned names, instance child/net/attribute maps and pin arrays.}
+
+proc_redirect report_network_memory {
+  check_argc_eq0 "report_network_memory" $args
+  report_network_memory_cmd
+}
+
+################################################################
+
 define_cmd_args "report_net" {[-scene scene] [-digits digits]\
                                 net_path [> filename] [>> filename]} \
   -help {Report the connections and capacitance of a net.} \
@@ -408,6 +408,26 @@ NetworkNameAdapter::netIterator(const Instance *instance) const
   return network_->netIterator(instance);
 }
 
+void
+NetworkNameAdapter::reportMemory() const
+{
+  network_->reportMemory();
+}
+
+void
+NetworkNameAdapter::visitChildren(const Instance *instance,
+                                  NetworkInstanceVisitor &visitor) const
+{
+  network_->visitChildren(instance, visitor);
+}
+
+void
+NetworkNameAdapter::visitPins(const Instance *instance,
+                              NetworkPinVisitor &visitor) const
+{
+  network_->visitPins(instance, visitor);
+}
+
 ObjectId
 NetworkNameAdapter::id(const Pin *pin) const
 {
@@ -486,6 +506,34 @@ NetworkNameAdapter::termIterator(const Net *net) const
   return network_->termIterator(net);
 }
 
+void
+NetworkNameAdapter::visitPins(const Net *net,
+                              NetworkNetPinVisitor &visitor) const
+{
+  network_->visitPins(net, visitor);
+}
+
+void
+NetworkNameAdapter::visitTerms(const Net *net,
+                               NetworkTermVisitor &visitor) const
+{
+  network_->visitTerms(net, visitor);
+}
+
+void
+NetworkNameAdapter::visitConnectedPins(const Pin *pin,
+                                       PinVisitor &visitor) const
+{
+  network_->visitConnectedPins(pin, visitor);
+}
+
+void
+NetworkNameAdapter::visitConnectedPins(const Net *net,
+                                       PinVisitor &visitor) const
+{
+  network_->visitConnectedPins(net, visitor);
+}
+
 bool
 NetworkNameAdapter::isPower(const Net *net) const
 {
@@ -25,6 +25,7 @@
 #include "ConcreteParasitics.hh"
 
 #include <algorithm> // max
+#include <cstdint>
 
 #include "ConcreteParasiticsPvt.hh"
 #include "Debug.hh"
@@ -492,6 +493,8 @@ ConcreteParasiticNetwork::ConcreteParasiticNetwork(ConcreteParasiticNetwork &&pa
   net_(parasitic.net_),
   sub_nodes_(std::move(parasitic.sub_nodes_)),
   pin_nodes_(std::move(parasitic.pin_nodes_)),
+  resistors_(std::move(parasitic.resistors_)),
+  capacitors_(std::move(parasitic.capacitors_)),
   max_node_id_(parasitic.max_node_id_),
   includes_pin_caps_(parasitic.includes_pin_caps_)
 {
@@ -755,11 +758,20 @@ ConcreteParasitics::~ConcreteParasitics()
   deleteParasiticsImpl();
 }
 
+// Fibonacci hash of the pointer bits above the allocation alignment.
+size_t
+ConcreteParasitics::shardIndex(const void *key)
+{
+  uintptr_t bits = reinterpret_cast<uintptr_t>(key) >> 4;
+  return (bits * 0x9E3779B97F4A7C15ULL) >> (64 - shard_bits_);
+}
+
 bool
 ConcreteParasitics::haveParasitics()
 {
-  return !drvr_parasitic_map_.empty()
-    || !parasitic_network_map_.empty();
+  return drvr_parasitic_count_ > 0
+    || parasitic_network_count_ > 0
+    || !lazy_readers_.empty();
 }
 
 void
@@ -777,24 +789,36 @@ ConcreteParasitics::deleteParasitics()
 void
 ConcreteParasitics::deleteParasiticsImpl()
 {
-  for (auto &[drvr, parasitics] : drvr_parasitic_map_) {
-    for (size_t i = 0; i < min_max_rise_fall_count; i++)
-      delete parasitics[i];
+  for (ConcreteParasiticMap &drvr_parasitic_map : drvr_parasitic_maps_) {
+    for (auto &[drvr, parasitics] : drvr_parasitic_map) {
+      for (size_t i = 0; i < min_max_rise_fall_count; i++)
+        delete parasitics[i];
+    }
+    drvr_parasitic_map.clear();
   }
-  drvr_parasitic_map_.clear();
+  drvr_parasitic_count_ = 0;
 
-  parasitic_network_map_.clear();
+  for (ConcreteParasiticNetworkMap &parasitic_network_map : parasitic_network_maps_)
+    parasitic_network_map.clear();
+  parasitic_network_count_ = 0;
+
+  lazy_networks_.clear();
+  lazy_readers_.clear();
 }
 
 void
 ConcreteParasitics::deleteParasitics(const Pin *drvr_pin)
 {
-  auto itr = drvr_parasitic_map_.find(drvr_pin);
-  if (itr != drvr_parasitic_map_.end()) {
+  size_t shard = shardIndex(drvr_pin);
+  LockGuard lock(drvr_locks_[shard]);
+  ConcreteParasiticMap &drvr_parasitic_map = drvr_parasitic_maps_[shard];
+  auto itr = drvr_parasitic_map.find(drvr_pin);
+  if (itr != drvr_parasitic_map.end()) {
     const MinMaxRiseFallParasitics &parasitics = itr->second;
     for (size_t i = 0; i < min_max_rise_fall_count; i++)
       delete parasitics[i];
-    drvr_parasitic_map_.erase(itr);
+    drvr_parasitic_map.erase(itr);
+    drvr_parasitic_count_--;
   }
 }
 
@@ -805,7 +829,7 @@ ConcreteParasitics::deleteParasitics(const Net *net)
   for (auto drvr_pin : *drivers)
     deleteParasitics(drvr_pin);
 
-  parasitic_network_map_.erase(net);
+  deleteParasiticNetwork(net);
 }
 
 float
@@ -842,6 +866,8 @@ ConcreteParasitics::disconnectPinBefore(const Pin *pin)
         static_cast<ConcreteParasiticNetwork*>(findParasiticNetwork(pin));
       if (parasitic)
         parasitic->disconnectPin(pin, net, network_);
+      // Keep the edited network instead of reading it again.
+      forgetLazyNetwork(net);
     }
   }
 }
@@ -863,7 +889,7 @@ ConcreteParasitics::loadPinCapacitanceChanged(const Pin *pin)
 void
 ConcreteParasitics::deleteReducedParasitics(const Net *net)
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (drvr_parasitic_count_ > 0) {
     PinSet *drivers = network_->drivers(net);
     if (drivers) {
       for (auto drvr_pin : *drivers)
@@ -876,7 +902,7 @@ ConcreteParasitics::deleteReducedParasitics(const Net *net)
 void
 ConcreteParasitics::deleteReducedParasitics(const Pin *pin)
 {
-  if (!drvr_parasitic_map_.empty()) {
+  if (drvr_parasitic_count_ > 0) {
     PinSet *drivers = network_->drivers(pin);
     if (drivers) {
       for (auto drvr_pin : *drivers)
@@ -912,9 +938,11 @@ ConcreteParasitics::findPiElmore(const Pin *drvr_pin,
                                  const RiseFall *rf,
                                  const MinMax *min_max) const
 {
-  LockGuard lock(lock_);
-  auto itr = drvr_parasitic_map_.find(drvr_pin);
-  if (itr != drvr_parasitic_map_.end()) {
+  size_t shard = shardIndex(drvr_pin);
+  LockGuard lock(drvr_locks_[shard]);
+  const ConcreteParasiticMap &drvr_parasitic_map = drvr_parasitic_maps_[shard];
+  auto itr = drvr_parasitic_map.find(drvr_pin);
+  if (itr != drvr_parasitic_map.end()) {
     const MinMaxRiseFallParasitics &parasitics = itr->second;
     ConcreteParasitic *parasitic = parasitics[minMaxRiseFallIndex(min_max, rf)];
     if (parasitic && parasitic->isPiElmore())
@@ -931,11 +959,13 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
                                  float rpi,
                                  float c1)
 {
-  LockGuard lock(lock_);
-  auto itr = drvr_parasitic_map_.find(drvr_pin);
+  size_t shard = shardIndex(drvr_pin);
+  LockGuard lock(drvr_locks_[shard]);
+  ConcreteParasiticMap &drvr_parasitic_map = drvr_parasitic_maps_[shard];
+  auto itr = drvr_parasitic_map.find(drvr_pin);
   ConcretePiElmore *pi_elmore = nullptr;
   size_t mm_rf_index = minMaxRiseFallIndex(min_max, rf);
-  if (itr != drvr_parasitic_map_.end()) {
+  if (itr != drvr_parasitic_map.end()) {
     MinMaxRiseFallParasitics &parasitics = itr->second;
     ConcreteParasitic *parasitic = parasitics[mm_rf_index];
     if (parasitic && parasitic->isPiElmore()) {
@@ -950,7 +980,8 @@ ConcreteParasitics::makePiElmore(const Pin *drvr_pin,
     }
   }
   else {
-    MinMaxRiseFallParasitics &parasitics = drvr_parasitic_map_[drvr_pin];
+    MinMaxRiseFallParasitics &parasitics = drvr_parasitic_map[drvr_pin];
+    drvr_parasitic_count_++;
     for (size_t i = 0; i < min_max_rise_fall_count; i++)
       parasitics[i] = nullptr;
     pi_elmore = new ConcretePiElmore(c2, rpi, c1);
@@ -1029,9 +1060,11 @@ ConcreteParasitics::findPiPoleResidue(const Pin *drvr_pin,
                                       const RiseFall *rf,
                                       const MinMax *min_max) const
 {
-  LockGuard lock(lock_);
-  auto itr = drvr_parasitic_map_.find(drvr_pin);
-  if (itr != drvr_parasitic_map_.end()) {
+  size_t shard = shardIndex(drvr_pin);
+  LockGuard lock(drvr_locks_[shard]);
+  const ConcreteParasiticMap &drvr_parasitic_map = drvr_parasitic_maps_[shard];
+  auto itr = drvr_parasitic_map.find(drvr_pin);
+  if (itr != drvr_parasitic_map.end()) {
     const MinMaxRiseFallParasitics &parasitics = itr->second;
     size_t mm_rf_index = minMaxRiseFallIndex(min_max, rf);
     ConcreteParasitic *parasitic = parasitics[mm_rf_index];
@@ -1049,11 +1082,13 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
                                       float rpi,
                                       float c1)
 {
-  LockGuard lock(lock_);
-  auto itr = drvr_parasitic_map_.find(drvr_pin);
+  size_t shard = shardIndex(drvr_pin);
+  LockGuard lock(drvr_locks_[shard]);
+  ConcreteParasiticMap &drvr_parasitic_map = drvr_parasitic_maps_[shard];
+  auto itr = drvr_parasitic_map.find(drvr_pin);
   ConcretePiPoleResidue *pi_pole_residue = nullptr;
   size_t mm_rf_index = minMaxRiseFallIndex(min_max, rf);
-  if (itr != drvr_parasitic_map_.end()) {
+  if (itr != drvr_parasitic_map.end()) {
     MinMaxRiseFallParasitics &parasitics = itr->second;
     ConcreteParasitic *parasitic = parasitics[mm_rf_index];
     if (parasitic && parasitic->isPoleResidue()) {
@@ -1068,7 +1103,8 @@ ConcreteParasitics::makePiPoleResidue(const Pin *drvr_pin,
     }
   }
   else {
-    MinMaxRiseFallParasitics &parasitics = drvr_parasitic_map_[drvr_pin];
+    MinMaxRiseFallParasitics &parasitics = drvr_parasitic_map[drvr_pin];
+    drvr_parasitic_count_++;
     for (size_t i = 0; i < min_max_rise_fall_count; i++)
       parasitics[i] = nullptr;
     pi_pole_residue = new ConcretePiPoleResidue(c2, rpi, c1);
@@ -1138,9 +1174,21 @@ ConcreteParasitics::isParasiticNetwork(const Parasitic *parasitic) const
 Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Net *net)
 {
-  LockGuard lock(lock_);
-  auto itr = parasitic_network_map_.find(net);
-  if (itr != parasitic_network_map_.end())
+  Parasitic *parasitic = findParasiticNetwork1(net);
+  if (parasitic == nullptr
+      && !lazy_readers_.empty())
+    parasitic = readLazyNetwork(net);
+  return parasitic;
+}
+
+Parasitic *
+ConcreteParasitics::findParasiticNetwork1(const Net *net)
+{
+  size_t shard = shardIndex(net);
+  LockGuard lock(network_locks_[shard]);
+  ConcreteParasiticNetworkMap &parasitic_network_map = parasitic_network_maps_[shard];
+  auto itr = parasitic_network_map.find(net);
+  if (itr != parasitic_network_map.end())
     return &itr->second;
   else
     return nullptr;
@@ -1149,43 +1197,186 @@ ConcreteParasitics::findParasiticNetwork(const Net *net)
 Parasitic *
 ConcreteParasitics::findParasiticNetwork(const Pin *pin)
 {
-  if (!parasitic_network_map_.empty()) {
-    LockGuard lock(lock_);
-    if (!parasitic_network_map_.empty()) {
-      // Only call findParasiticNet if parasitics exist.
-      const Net *net = findParasiticNet(pin);
-
-      if (!parasitic_network_map_.empty()) {
-        auto itr = parasitic_network_map_.find(net);
-        if (itr != parasitic_network_map_.end())
-          return &itr->second;
-      }
-    }
+  // Only call findParasiticNet if parasitics exist.
+  if (parasitic_network_count_ > 0
+      || !lazy_readers_.empty()) {
+    const Net *net = findParasiticNet(pin);
+    if (net)
+      return findParasiticNetwork(net);
   }
   return nullptr;
 }
 
+// Thread safe for different nets.
 Parasitic *
 ConcreteParasitics::makeParasiticNetwork(const Net *net,
                                          bool includes_pin_caps)
 {
-  LockGuard lock(lock_);
-  auto itr = parasitic_network_map_.find(net);
-  if (itr != parasitic_network_map_.end()) {
-    parasitic_network_map_.erase(itr);
+  forgetLazyNetwork(net);
+  return makeParasiticNetwork1(net, includes_pin_caps);
+}
+
+Parasitic *
+ConcreteParasitics::makeParasiticNetwork1(const Net *net,
+                                          bool includes_pin_caps)
+{
+  return addParasiticNetwork(ConcreteParasiticNetwork(net, includes_pin_caps,
+                                                      network_));
+}
+
+// Replace the parasitic network of the parasitic's net.
+Parasitic *
+ConcreteParasitics::addParasiticNetwork(ConcreteParasiticNetwork &&parasitic)
+{
+  const Net *net = parasitic.net();
+  size_t shard = shardIndex(net);
+  LockGuard lock(network_locks_[shard]);
+  ConcreteParasiticNetworkMap &parasitic_network_map = parasitic_network_maps_[shard];
+  auto itr = parasitic_network_map.find(net);
+  if (itr != parasitic_network_map.end()) {
+    parasitic_network_map.erase(itr);
+    parasitic_network_count_--;
+    // Network locks are always taken before driver locks.
     for (const Pin *drvr_pin : *network_->drivers(net))
       deleteParasitics(drvr_pin);
   }
-  parasitic_network_map_.emplace(net, ConcreteParasiticNetwork(net, includes_pin_caps,
-                                                               network_));
-  return &parasitic_network_map_.find(net)->second;
+  auto [new_itr, inserted] =
+    parasitic_network_map.emplace(net, std::move(parasitic));
+  parasitic_network_count_++;
+  return &new_itr->second;
 }
 
 void
 ConcreteParasitics::deleteParasiticNetwork(const Net *net)
 {
-  LockGuard lock(lock_);
-  parasitic_network_map_.erase(net);
+  forgetLazyNetwork(net);
+  deleteParasiticNetwork1(net);
+}
+
+void
+ConcreteParasitics::deleteParasiticNetwork1(const Net *net)
+{
+  size_t shard = shardIndex(net);
+  LockGuard lock(network_locks_[shard]);
+  if (parasitic_network_maps_[shard].erase(net))
+    parasitic_network_count_--;
+}
+
+////////////////////////////////////////////////////////////////
+
+void
+ConcreteParasitics::addLazyNetworkReader(LazyParasiticNetworkReader *reader)
+{
+  lazy_readers_.emplace_back(reader);
+}
+
+// Not thread safe.
+void
+ConcreteParasitics::setLazyParasiticNetwork(const Net *net,
+                                            LazyParasiticNetworkReader *reader,
+                                            size_t offset,
+                                            size_t length,
+                                            int line)
+{
+  deleteReducedParasitics(net);
+  deleteParasiticNetwork1(net);
+  ObjectId id = network_->id(net);
+  if (id >= lazy_networks_.size())
+    lazy_networks_.resize(id + 1);
+  lazy_networks_[id] = {reader, offset, length, line, false, false, false};
+}
+
+// Caller holds the lazy lock for the net's shard.
+LazyParasiticNetwork *
+ConcreteParasitics::findLazyNetwork(const Net *net)
+{
+  ObjectId id = network_->id(net);
+  if (id < lazy_networks_.size()) {
+    LazyParasiticNetwork &lazy = lazy_networks_[id];
+    if (lazy.reader)
+      return &lazy;
+  }
+  return nullptr;
+}
+
+// Thread safe. The network is parsed without the shard lock so reads of
+// other nets in the shard are not blocked. Threads that want the same
+// network wait for the thread reading it.
+Parasitic *
+ConcreteParasitics::readLazyNetwork(const Net *net)
+{
+  size_t shard = shardIndex(net);
+  std::unique_lock lock(lazy_locks_[shard]);
+  LazyParasiticNetwork *lazy = findLazyNetwork(net);
+  if (lazy == nullptr)
+    return nullptr;
+  lazy_read_cvs_[shard].wait(lock, [lazy] () { return !lazy->is_reading; });
+  Parasitic *parasitic = findParasiticNetwork1(net);
+  if (parasitic == nullptr && lazy->reader) {
+    lazy->is_reading = true;
+    LazyParasiticNetworkReader *reader = lazy->reader;
+    LazyParasiticNetwork location = *lazy;
+    lock.unlock();
+
+    debugPrint(debug_, "parasitics", 2, "read lazy parasitic network {}",
+               network_->pathName(net));
+    // The network is added when it is complete so findParasiticNetwork
+    // does not find it partially read.
+    ConcreteParasiticNetwork parasitic_network(net, reader->includesPinCaps(),
+                                               network_);
+    reader->readNetwork(net, location, &parasitic_network);
+    parasitic = addParasiticNetwork(std::move(parasitic_network));
+
+    lock.lock();
+    lazy->is_reading = false;
+    lazy->is_read = true;
+    lazy->was_read = true;
+    lazy_read_cvs_[shard].notify_all();
+  }
+  return parasitic;
+}
+
+// The network of the driver's net is deleted if it can be read again.
+void
+ConcreteParasitics::releaseParasiticNetwork(const Pin *drvr_pin)
+{
+  if (!lazy_readers_.empty()) {
+    const Net *net = findParasiticNet(drvr_pin);
+    if (net) {
+      LockGuard lock(lazy_locks_[shardIndex(net)]);
+      LazyParasiticNetwork *lazy = findLazyNetwork(net);
+      // Edited networks have no reader to read them again.
+      if (lazy && lazy->reader && lazy->is_read) {
+        deleteParasiticNetwork1(net);
+        lazy->is_read = false;
+      }
+    }
+  }
+}
+
+void
+ConcreteParasitics::reportNetworkReadMessages()
+{
+  for (auto &reader : lazy_readers_)
+    reader->reportMessages();
+}
+
+size_t
+ConcreteParasitics::parasiticNetworkCount() const
+{
+  return parasitic_network_count_;
+}
+
+// Edited or replaced networks are no longer read lazily.
+void
+ConcreteParasitics::forgetLazyNetwork(const Net *net)
+{
+  if (!lazy_readers_.empty()) {
+    LockGuard lock(lazy_locks_[shardIndex(net)]);
+    LazyParasiticNetwork *lazy = findLazyNetwork(net);
+    if (lazy)
+      lazy->reader = nullptr;
+  }
 }
 
 const Net *
@@ -25,9 +25,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "MinMax.hh"
 #include "Parasitics.hh"
@@ -36,6 +40,7 @@ namespace sta {
 
 class ConcreteParasitic;
 class ConcreteParasiticNetwork;
+class LazyParasiticNetworkReader;
 
 constexpr size_t min_max_rise_fall_count = MinMax::index_count * RiseFall::index_count;
 // Min/maxrise/fall reduced parasitics for each driver pin.
@@ -46,6 +51,40 @@ using MinMaxRiseFallParasitics = std::array<ConcreteParasitic*, min_max_rise_fal
 using ConcreteParasiticMap = std::map<const Pin*, MinMaxRiseFallParasitics>;
 using ConcreteParasiticNetworkMap = std::map<const Net*, ConcreteParasiticNetwork>;
 
+// Where to find the parasitic network of a net that is read when it
+// is first needed.
+struct LazyParasiticNetwork
+{
+  LazyParasiticNetworkReader *reader;
+  size_t offset;
+  size_t length;
+  int line;
+  // The network is resident because it was read by reader.
+  bool is_read;
+  // The network has been read before, so reader messages are repeats.
+  bool was_read;
+  // A thread is reading the network.
+  bool is_reading;
+};
+
+using LazyParasiticNetworkSeq = std::vector<LazyParasiticNetwork>;
+
+// Reads the parasitic networks of nets recorded by
+// ConcreteParasitics::setLazyParasiticNetwork.
+class LazyParasiticNetworkReader
+{
+public:
+  virtual ~LazyParasiticNetworkReader() = default;
+  // Fill in parasitic, the empty network of net.
+  // Called by delay calculation threads for different nets.
+  virtual void readNetwork(const Net *net,
+                           const LazyParasiticNetwork &location,
+                           Parasitic *parasitic) = 0;
+  virtual bool includesPinCaps() const = 0;
+  // Report the messages saved by readNetwork.
+  virtual void reportMessages() = 0;
+};
+
 // This class acts as a BUILDER for parasitics.
 class ConcreteParasitics : public Parasitics
 {
@@ -183,20 +222,63 @@ public:
   void deleteReducedParasitics(const Net *net) override;
   void deleteDrvrReducedParasitics(const Pin *drvr_pin) override;
 
+  // Lazy parasitic networks are read by findParasiticNetwork when
+  // delay calculation first asks for them and deleted by
+  // releaseParasiticNetwork when it is done with them.
+  // Takes ownership of reader.
+  void addLazyNetworkReader(LazyParasiticNetworkReader *reader);
+  // Replace the parasitic network of net with one read by reader.
+  void setLazyParasiticNetwork(const Net *net,
+                               LazyParasiticNetworkReader *reader,
+                               size_t offset,
+                               size_t length,
+                               int line);
+  void releaseParasiticNetwork(const Pin *drvr_pin) override;
+  void reportNetworkReadMessages() override;
+  size_t parasiticNetworkCount() const override;
+
 protected:
   void deleteParasiticsImpl();
   Parasitic *ensureRspf(const Pin *drvr_pin);
   void makeAnalysisPtAfter();
   void deleteReducedParasitics(const Pin *pin);
+  static size_t shardIndex(const void *key);
+  Parasitic *findParasiticNetwork1(const Net *net);
+  Parasitic *makeParasiticNetwork1(const Net *net,
+                                   bool includes_pin_caps);
+  Parasitic *addParasiticNetwork(ConcreteParasiticNetwork &&parasitic);
+  void deleteParasiticNetwork1(const Net *net);
+  Parasitic *readLazyNetwork(const Net *net);
+  LazyParasiticNetwork *findLazyNetwork(const Net *net);
+  void forgetLazyNetwork(const Net *net);
 
   std::string name_;
   std::string filename_;
 
+  // The maps are split into shards by key, each with its own lock, so
+  // threads building parasitics (parallel spef reading, parasitic
+  // reduction) for different nets rarely wait on each other.
+  static constexpr size_t shard_bits_ = 4;
+  static constexpr size_t shard_count_ = 1 << shard_bits_;
   // Driver pin to array of parasitics indexed by analysis pt index
   // and transition.
-  ConcreteParasiticMap drvr_parasitic_map_;
-  ConcreteParasiticNetworkMap parasitic_network_map_;
-  mutable std::mutex lock_;
+  std::array<ConcreteParasiticMap, shard_count_> drvr_parasitic_maps_;
+  std::array<ConcreteParasiticNetworkMap, shard_count_> parasitic_network_maps_;
+  mutable std::array<std::mutex, shard_count_> drvr_locks_;
+  mutable std::array<std::mutex, shard_count_> network_locks_;
+  // Entries in all of the shards, for lock free emptiness checks.
+  std::atomic<size_t> drvr_parasitic_count_{0};
+  std::atomic<size_t> parasitic_network_count_{0};
+
+  std::vector<std::unique_ptr<LazyParasiticNetworkReader>> lazy_readers_;
+  // Indexed by net id. Entries with a null reader are not lazy.
+  // Only resized between delay calculations; entries are guarded by
+  // lazy_locks_ for the net's shard.
+  LazyParasiticNetworkSeq lazy_networks_;
+  // Taken before the network and driver locks.
+  mutable std::array<std::mutex, shard_count_> lazy_locks_;
+  // Notified when a thread finishes reading a network in the shard.
+  std::array<std::condition_variable, shard_count_> lazy_read_cvs_;
 
   friend class ConcretePiElmore;
   friend class ConcreteParasiticNode;
@@ -43,6 +43,22 @@ Parasitics::Parasitics(StaState *sta) :
 {
 }
 
+void
+Parasitics::releaseParasiticNetwork(const Pin *)
+{
+}
+
+void
+Parasitics::reportNetworkReadMessages()
+{
+}
+
+size_t
+Parasitics::parasiticNetworkCount() const
+{
+  return 0;
+}
+
 void
 Parasitics::report(const Parasitic *parasitic) const
 {
@@ -23,9 +23,12 @@
 // This notice may not be removed or altered from any source distribution.
 
 %{
+#include "Parasitics.hh"
+#include "Scene.hh"
 #include "Sta.hh"
 
 using sta::Sta;
+using sta::Parasitics;
 using sta::Instance;
 using sta::MinMaxAll;
 using sta::RiseFall;
@@ -44,12 +47,22 @@ read_spef_cmd(const char *name,
               bool pin_cap_included,
               bool keep_coupling_caps,
               float coupling_cap_factor,
-              bool reduce)
+              bool reduce,
+              bool lazy)
 {
   return Sta::sta()->readSpef(name, filename, instance,
                               scene, min_max,
                               pin_cap_included, keep_coupling_caps,
-                              coupling_cap_factor, reduce);
+                              coupling_cap_factor, reduce, lazy);
+}
+
+// Parasitic networks held in memory (for regressions).
+int
+parasitic_network_count()
+{
+  const Parasitics *parasitics =
+    Sta::sta()->cmdScene()->parasitics(MinMax::max());
+  return parasitics ? parasitics->parasiticNetworkCount() : 0;
 }
 
 void
@@ -86,6 +86,7 @@ void
 ReportParasiticAnnotation::reportAnnotation()
 {
   findCounts();
+  parasitics_->reportNetworkReadMessages();
   reportAnnotationCounts();
 }
 
@@ -112,6 +113,8 @@ ReportParasiticAnnotation::reportAnnotationCounts()
             parasitics_->unannotatedLoads(parasitic, drvr_pin);
         for (const Pin *load_pin : unannotated_loads)
           report_->report("  {}", network_->pathName(load_pin));
+        // Lazily read networks are deleted when they are not needed.
+        parasitics_->releaseParasiticNetwork(drvr_pin);
       }
     }
   }
@@ -134,6 +137,7 @@ ReportParasiticAnnotation::findCounts()
         PinSet unannotated_loads = parasitics_->unannotatedLoads(parasitic, pin);
         if (!unannotated_loads.empty())
           partially_annotated_.push_back(pin);
+        parasitics_->releaseParasiticNetwork(pin);
       }
       else
         unannotated_.push_back(pin);
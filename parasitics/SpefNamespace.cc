@@ -38,6 +38,7 @@ spefToSta(std::string_view spef_name,
 {
   const char spef_escape = '\\';
   std::string sta_name;
+  sta_name.reserve(spef_name.size());
   for (size_t i = 0; i < spef_name.size(); i++) {
     char ch = spef_name[i];
     if (ch == spef_escape) {
@@ -41,7 +41,7 @@ void
 sta::SpefParse::error(const location_type &loc,
                      const std::string &msg)
 {
-  reader->report()->fileError(1670, reader->filename(), loc.begin.line, "{}", msg);
+  reader->error(1670, loc.begin.line, msg);
 }
 %}
 
@@ -86,6 +86,9 @@ class SpefTriple;
 %token D_NET D_PNET R_NET R_PNET END
 %token CONN CAP RES INDUC KW_P KW_I KW_N DRIVER CELL C2_R1_C1 LOADS
 %token RC KW_Q KW_K
+// Never in the file. The scanner returns one first to parse only the
+// header or only nets when a file is split between threads.
+%token SPEF_HEADER SPEF_NETS
 
 %type <int> conf cap_id res_id induc_id cap_elem cap_elems
 %type <int> res_elem res_elems induc_elem induc_elems
@@ -123,6 +126,12 @@ class SpefTriple;
 
 %start file
 
+%initial-action
+{
+  // Scanners for the nets of a split file start mid file.
+  @$.begin.line = @$.end.line = scanner->line();
+}
+
 %%
 
 file:
@@ -132,6 +141,14 @@ file:
 	external_def
 	define_def
 	internal_def
+|	SPEF_HEADER
+	header_def
+	name_map
+	power_def
+	external_def
+	define_def
+|	SPEF_NETS
+	internal_def
 ;
 
 /****************************************************************/
@@ -24,13 +24,19 @@
 
 #include "SpefReader.hh"
 
+#include <algorithm>
+#include <charconv>
 #include <string>
 #include <string_view>
 #include <utility>
 
 #include "ArcDelayCalc.hh"
+#include "ConcreteParasitics.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
+#include "FileBuffer.hh"
 #include "Liberty.hh"
+#include "Mutex.hh"
 #include "Network.hh"
 #include "Parasitics.hh"
 #include "PortDirection.hh"
@@ -42,7 +48,6 @@
 #include "Stats.hh"
 #include "StringUtil.hh"
 #include "Transition.hh"
-#include "Zlib.hh"
 #include "parasitics/SpefScanner.hh"
 
 namespace sta {
@@ -54,13 +59,15 @@ readSpefFile(std::string_view filename,
              bool keep_coupling_caps,
              float coupling_cap_factor,
              bool reduce,
+             bool lazy,
              const Scene *scene,
              const MinMaxAll *min_max,
              Parasitics *parasitics,
              StaState *sta)
 {
   SpefReader reader(filename, instance, pin_cap_included, keep_coupling_caps,
-                    coupling_cap_factor, reduce, scene, min_max, parasitics, sta);
+                    coupling_cap_factor, reduce, lazy, scene, min_max,
+                    parasitics, sta);
   bool success = reader.read();
   return success;
 }
@@ -71,6 +78,7 @@ SpefReader::SpefReader(std::string_view filename,
                        bool keep_coupling_caps,
                        float coupling_cap_factor,
                        bool reduce,
+                       bool lazy,
                        const Scene *scene,
                        const MinMaxAll *min_max,
                        Parasitics *parasitics,
@@ -82,8 +90,10 @@ SpefReader::SpefReader(std::string_view filename,
   keep_coupling_caps_(keep_coupling_caps),
   coupling_cap_factor_(coupling_cap_factor),
   reduce_(reduce),
+  lazy_(lazy),
   scene_(scene),
   min_max_(min_max),
+  name_map_(std::make_shared<SpefNameMap>()),
   parasitics_(parasitics)
 {
   parasitics->setCouplingCapFactor(coupling_cap_factor);
@@ -93,15 +103,31 @@ bool
 SpefReader::read()
 {
   bool success;
-  gzstream::igzstream stream(std::string(filename_).c_str());
-  if (stream.is_open()) {
+  auto buffer = std::make_unique<FileBuffer>();
+  if (buffer->read(filename_)) {
     Stats stats(debug_, report_);
-    SpefScanner scanner(&stream, filename_, this, report_);
-    scanner_ = &scanner;
-    SpefParse parser(&scanner, this);
-    // parser.set_debug_level(1);
-    //  yyparse returns 0 on success.
-    success = (parser.parse() == 0);
+    // Nets below the top instance share parasitic networks with the
+    // nets above them, so they are read serially.
+    bool is_top = network_->isTopInstance(instance_);
+    ConcreteParasitics *concrete_parasitics =
+      dynamic_cast<ConcreteParasitics*>(parasitics_);
+    if (buffer->isCompressed()) {
+      // The window over a compressed file cannot be kept to read the
+      // networks later without holding the whole file in memory.
+      if (lazy_)
+        report_->warn(2731, "-lazy ignored for gzip compressed files.");
+      success = readCompressed();
+    }
+    else if (lazy_ && is_top && concrete_parasitics)
+      success = readLazy(std::move(buffer), concrete_parasitics);
+    else {
+      if (lazy_ && !is_top)
+        report_->warn(2730, "-lazy ignored with -path.");
+      if (thread_count_ > 1 && is_top)
+        success = readParallel(buffer->contents());
+      else
+        success = parse(buffer->contents(), 1, 0);
+    }
     stats.report("Read spef");
   }
   else
@@ -109,6 +135,257 @@ SpefReader::read()
   return success;
 }
 
+bool
+SpefReader::parse(std::string_view text,
+                  int line,
+                  int start_token)
+{
+  SpefScanner scanner(text, line, this);
+  scanner.setStartToken(start_token);
+  return parse(scanner);
+}
+
+bool
+SpefReader::parse(SpefScanner &scanner)
+{
+  scanner_ = &scanner;
+  SpefParse parser(&scanner, this);
+  // parser.set_debug_level(1);
+  //  yyparse returns 0 on success.
+  bool success = (parser.parse() == 0);
+  scanner_ = nullptr;
+  return success;
+}
+
+// Gzip files are inflated a window at a time as they are scanned rather
+// than into one buffer, so they are read serially.
+bool
+SpefReader::readCompressed()
+{
+  if (!CompressedFileWindow::isSupported())
+    report_->error(1659, "{} is gzip compressed but zlib is not available.",
+                   filename_);
+  CompressedFileWindow window;
+  if (!window.open(filename_))
+    throw FileNotReadable(filename_);
+  SpefScanner scanner(&window, this);
+  bool success = parse(scanner);
+  if (window.readError())
+    throw FileNotReadable(filename_);
+  return success;
+}
+
+// Parse the header serially and then split the nets into chunks that
+// are parsed by copies of the reader on the dispatch queue threads.
+// The *D_NET/*R_NET sections only depend on the header.
+bool
+SpefReader::readParallel(std::string_view text)
+{
+  size_t nets_begin = findNetStart(text, 0);
+  if (nets_begin == std::string_view::npos)
+    return parse(text, 1, 0);
+
+  if (!parse(text.substr(0, nets_begin), 1, SpefParse::token::SPEF_HEADER))
+    return false;
+
+  // Chunk boundaries at the net starts following evenly spaced offsets.
+  size_t chunk_count = thread_count_ * chunks_per_thread_;
+  size_t nets_size = text.size() - nets_begin;
+  std::vector<size_t> chunk_begins{nets_begin};
+  for (size_t i = 1; i < chunk_count; i++) {
+    size_t offset = nets_begin + nets_size / chunk_count * i;
+    size_t chunk_begin = findNetStart(text, std::max(offset,
+                                                     chunk_begins.back() + 1));
+    if (chunk_begin == std::string_view::npos)
+      break;
+    if (chunk_begin > chunk_begins.back())
+      chunk_begins.push_back(chunk_begin);
+  }
+  chunk_count = chunk_begins.size();
+  chunk_begins.push_back(text.size());
+
+  std::vector<int> chunk_lines(chunk_count);
+  int line = 1 + std::count(text.begin(), text.begin() + nets_begin, '\n');
+  for (size_t i = 0; i < chunk_count; i++) {
+    chunk_lines[i] = line;
+    line += std::count(text.begin() + chunk_begins[i],
+                       text.begin() + chunk_begins[i + 1], '\n');
+  }
+
+  size_t task_count = std::min(static_cast<size_t>(thread_count_), chunk_count);
+  std::vector<SpefReader> readers(task_count, *this);
+  // Parasitic reduction uses per thread delay calculator state.
+  std::vector<ArcDelayCalc*> arc_delay_calcs;
+  if (reduce_) {
+    for (SpefReader &reader : readers) {
+      reader.arc_delay_calc_ = arc_delay_calc_->copy();
+      arc_delay_calcs.push_back(reader.arc_delay_calc_);
+    }
+  }
+  std::vector<SpefMsgSeq> chunk_msgs(chunk_count);
+  std::vector<char> chunk_success(chunk_count, false);
+  dispatch_queue_->parallelFor(chunk_count, task_count, 1,
+    [&](size_t task, size_t begin, size_t end) {
+      SpefReader &reader = readers[task];
+      for (size_t i = begin; i < end; i++) {
+        reader.deferred_msgs_ = &chunk_msgs[i];
+        std::string_view chunk = text.substr(chunk_begins[i],
+                                             chunk_begins[i + 1] - chunk_begins[i]);
+        chunk_success[i] = reader.parse(chunk, chunk_lines[i],
+                                        SpefParse::token::SPEF_NETS);
+      }
+    });
+  for (ArcDelayCalc *arc_delay_calc : arc_delay_calcs)
+    delete arc_delay_calc;
+  debugPrint(debug_, "spef_reader", 1, "read {} net chunks with {} threads",
+             chunk_count, task_count);
+
+  // Report the messages in file order.
+  bool success = true;
+  for (size_t i = 0; i < chunk_count; i++) {
+    for (const SpefMsg &msg : chunk_msgs[i]) {
+      if (msg.is_error)
+        report_->fileError(msg.id, filename_, msg.line, "{}", msg.msg);
+      else
+        report_->fileWarn(msg.id, filename_, msg.line, "{}", msg.msg);
+    }
+    success &= chunk_success[i];
+  }
+  return success;
+}
+
+// Parse the header and the *R_NET sections and record where each
+// *D_NET section is so SpefLazyReader can parse it when the parasitic
+// network is needed. The file contents are kept by the lazy reader.
+bool
+SpefReader::readLazy(std::unique_ptr<FileBuffer> buffer,
+                     ConcreteParasitics *parasitics)
+{
+  std::string_view text = buffer->contents();
+  size_t nets_begin = findNetStart(text, 0);
+  if (nets_begin == std::string_view::npos)
+    return parse(text, 1, 0);
+
+  if (!parse(text.substr(0, nets_begin), 1, SpefParse::token::SPEF_HEADER))
+    return false;
+
+  // The lazy reader starts with the header state.
+  SpefLazyReader *lazy_reader = new SpefLazyReader(*this, std::move(buffer));
+  parasitics->addLazyNetworkReader(lazy_reader);
+
+  bool success = true;
+  size_t lazy_count = 0;
+  int line = 1 + std::count(text.begin(), text.begin() + nets_begin, '\n');
+  size_t net_begin = nets_begin;
+  while (net_begin < text.size()) {
+    size_t net_end = findNetStart(text, net_begin + 1);
+    if (net_end == std::string_view::npos)
+      net_end = text.size();
+    std::string_view section = text.substr(net_begin, net_end - net_begin);
+    Net *net;
+    if (findDspfNet(section, line, net)) {
+      if (net) {
+        parasitics->setLazyParasiticNetwork(net, lazy_reader, net_begin,
+                                            section.size(), line);
+        lazy_count++;
+      }
+    }
+    else
+      success &= parse(section, line, SpefParse::token::SPEF_NETS);
+    line += std::count(section.begin(), section.end(), '\n');
+    net_begin = net_end;
+  }
+  debugPrint(debug_, "spef_reader", 1, "indexed {} lazy parasitic networks",
+             lazy_count);
+  return success;
+}
+
+// True if section is a *D_NET. net is the net it annotates, or
+// nullptr if it is not found.
+bool
+SpefReader::findDspfNet(std::string_view section,
+                        int line,
+                        Net *&net)
+{
+  SpefScanner scanner(section, line, this);
+  scanner_ = &scanner;
+  net = nullptr;
+  bool is_dspf = false;
+  SpefParse::semantic_type value;
+  SpefParse::location_type loc;
+  if (scanner.lex(&value, &loc) == SpefParse::token::D_NET) {
+    switch (scanner.lex(&value, &loc)) {
+    case SpefParse::token::IDENT:
+    case SpefParse::token::NAME:
+    case SpefParse::token::INDEX:
+      net = findNet(value.as<std::string>());
+      value.destroy<std::string>();
+      is_dspf = true;
+      break;
+    case SpefParse::token::QSTRING:
+      value.destroy<std::string>();
+      break;
+    case SpefParse::token::INTEGER:
+      value.destroy<int>();
+      break;
+    case SpefParse::token::FLOAT:
+      value.destroy<float>();
+      break;
+    default:
+      break;
+    }
+  }
+  scanner_ = nullptr;
+  return is_dspf;
+}
+
+// Offset of the first line at or after from that starts a net, or npos.
+// Block comments and quoted strings are not tracked, so a line in one
+// that starts with *D_NET is mistaken for a net.
+size_t
+SpefReader::findNetStart(std::string_view text,
+                         size_t from)
+{
+  size_t pos = from;
+  // Start at the beginning of a line.
+  if (pos > 0 && pos < text.size() && text[pos - 1] != '\n') {
+    pos = text.find('\n', pos);
+    if (pos == std::string_view::npos)
+      return pos;
+    pos++;
+  }
+  while (pos < text.size()) {
+    size_t keyword = text.find_first_not_of(" \t", pos);
+    if (keyword == std::string_view::npos)
+      break;
+    std::string_view line = text.substr(keyword);
+    for (std::string_view net_keyword : {"*D_NET", "*R_NET", "*D_PNET", "*R_PNET"}) {
+      if (line.starts_with(net_keyword)
+          && line.size() > net_keyword.size()) {
+        char next = line[net_keyword.size()];
+        if (next == ' ' || next == '\t' || next == '\r' || next == '\n')
+          return pos;
+      }
+    }
+    pos = text.find('\n', keyword);
+    if (pos == std::string_view::npos)
+      break;
+    pos++;
+  }
+  return std::string_view::npos;
+}
+
+void
+SpefReader::error(int id,
+                  int line,
+                  std::string_view msg)
+{
+  if (deferred_msgs_)
+    deferred_msgs_->push_back({id, line, true, std::string(msg)});
+  else
+    report_->fileError(id, filename_, line, "{}", msg);
+}
+
 void
 SpefReader::setDivider(char divider)
 {
@@ -226,27 +503,66 @@ SpefReader::setInductScale(float scale,
     warn(1644, "unknown units {}.", units);
 }
 
+void
+SpefNameMap::insert(size_t index,
+                    std::string_view name)
+{
+  if (index < dense_.size())
+    dense_[index] = name;
+  else if (index <= dense_.size() * 2 + dense_min_) {
+    dense_.resize(index + 1);
+    dense_[index] = name;
+  }
+  else
+    sparse_[index] = name;
+}
+
+const std::string *
+SpefNameMap::find(size_t index) const
+{
+  if (index < dense_.size()
+      && !dense_[index].empty())
+    return &dense_[index];
+  auto itr = sparse_.find(index);
+  if (itr != sparse_.end())
+    return &itr->second;
+  return nullptr;
+}
+
+// Parse the integer following the '*' of a name map index.
+static bool
+nameMapIndex(std::string_view index,
+             size_t &i)
+{
+  const char *begin = index.data() + 1;
+  const char *end = index.data() + index.size();
+  auto [ptr, ec] = std::from_chars(begin, end, i);
+  return ec == std::errc() && ptr == end;
+}
+
 void
 SpefReader::makeNameMapEntry(std::string_view index,
                              std::string_view name)
 {
-  int i = std::stoi(std::string(index.substr(1)));
-  name_map_[i] = name;
+  size_t i;
+  if (nameMapIndex(index, i))
+    name_map_->insert(i, name);
 }
 
 std::string_view
 SpefReader::nameMapLookup(std::string_view name)
 {
   if (!name.empty() && name[0] == '*') {
-    std::string index_str(name.substr(1));
-    int index = std::stoi(index_str);
-    const auto &itr = name_map_.find(index);
-    if (itr != name_map_.end())
-      return itr->second;
-    else {
+    size_t index;
+    if (nameMapIndex(name, index)) {
+      const std::string *mapped = name_map_->find(index);
+      if (mapped)
+        return *mapped;
       warn(1645, "no name map entry for {}.", index);
-      return "";
     }
+    else
+      warn(1645, "no name map entry for {}.", name.substr(1));
+    return "";
   }
   else
     return name;
@@ -281,11 +597,10 @@ SpefReader::findPin(std::string_view name)
   if (!name.empty()) {
     size_t delim = name.rfind(delimiter_);
     if (delim != std::string::npos) {
-      std::string inst_name_mapped(name.substr(0, delim));
-      std::string_view inst_name = nameMapLookup(inst_name_mapped);
+      std::string_view inst_name = nameMapLookup(name.substr(0, delim));
       if (!inst_name.empty()) {
         Instance *inst = findInstanceRelative(inst_name);
-        std::string port_name(name.substr(delim + 1, std::string::npos));
+        std::string_view port_name = name.substr(delim + 1);
         if (inst) {
           pin = network_->findPin(inst, port_name);
           if (pin == nullptr)
@@ -372,19 +687,24 @@ SpefReader::dspfBegin(Net *net,
                       SpefTriple *total_cap)
 {
   if (net) {
-    if (network_->isTopInstance(instance_)) {
+    if (lazy_parasitic_)
+      parasitic_ = lazy_parasitic_;
+    else if (network_->isTopInstance(instance_)) {
       parasitics_->deleteReducedParasitics(net);
       parasitic_ = parasitics_->makeParasiticNetwork(net, pin_cap_included_);
     }
     else {
+      // The parasitic is owned by the net above the first terminal.
+      const Term *first_term = nullptr;
+      network_->visitTerms(net, [&](const Term *term) {
+        if (first_term == nullptr)
+          first_term = term;
+      });
       Net *parasitic_owner = net;
-      NetTermIterator *term_iter = network_->termIterator(net);
-      if (term_iter->hasNext()) {
-        Term *term = term_iter->next();
-        Pin *hpin = network_->pin(term);
+      if (first_term) {
+        Pin *hpin = network_->pin(first_term);
         parasitic_owner = network_->net(hpin);
       }
-      delete term_iter;
       parasitic_ = parasitics_->findParasiticNetwork(parasitic_owner);
       if (parasitic_ == nullptr)
         parasitic_ =
@@ -417,9 +737,8 @@ SpefReader::findParasiticNode(std::string_view name,
   if (!name.empty() && parasitic_) {
     size_t delim = name.rfind(delimiter_);
     if (delim != std::string::npos) {
-      std::string name1_mapped(name.substr(0, delim));
-      std::string name2(name.substr(delim + 1, std::string::npos));
-      std::string_view name1 = nameMapLookup(name1_mapped);
+      std::string_view name2 = name.substr(delim + 1);
+      std::string_view name1 = nameMapLookup(name.substr(0, delim));
       if (!name1.empty()) {
         Instance *inst = findInstanceRelative(name1);
         if (inst) {
@@ -439,8 +758,12 @@ SpefReader::findParasiticNode(std::string_view name,
           Net *net = findNet(name1);
           if (net) {
             // <net>:<subnode_id>
-            if (isDigits(name2)) {
-              uint32_t id = std::stoi(name2);
+            uint32_t id;
+            auto [ptr, ec] = std::from_chars(name2.data(),
+                                             name2.data() + name2.size(), id);
+            if (!name2.empty()
+                && ec == std::errc()
+                && ptr == name2.data() + name2.size()) {
               if (local_only && !network_->isConnected(net, net_))
                 warn(1653, "{}{}{} not connected to net {}.",
                      name1, delimiter_, name2, network_->pathName(net_));
@@ -545,6 +868,69 @@ SpefRspfPi::~SpefRspfPi()
 
 ////////////////////////////////////////////////////////////////
 
+SpefLazyReader::SpefLazyReader(const SpefReader &reader,
+                               std::unique_ptr<FileBuffer> buffer) :
+  filename_(reader.filename_),
+  buffer_(std::move(buffer)),
+  reader_(reader)
+{
+  // The reader outlives the read_spef filename.
+  reader_.filename_ = filename_;
+  // Lazy networks are reduced by delay calculation.
+  reader_.reduce_ = false;
+  reader_.design_flow_.clear();
+}
+
+SpefLazyReader::~SpefLazyReader() = default;
+
+bool
+SpefLazyReader::includesPinCaps() const
+{
+  return reader_.pin_cap_included_;
+}
+
+// Called by delay calculation threads, so the reader state is copied
+// and messages are saved for reportMessages. Messages are only saved
+// the first time a network is read.
+void
+SpefLazyReader::readNetwork(const Net *,
+                            const LazyParasiticNetwork &location,
+                            Parasitic *parasitic)
+{
+  SpefReader reader(reader_);
+  SpefMsgSeq msgs;
+  reader.deferred_msgs_ = &msgs;
+  reader.lazy_parasitic_ = parasitic;
+  std::string_view section = buffer_->contents().substr(location.offset,
+                                                        location.length);
+  reader.parse(section, location.line, SpefParse::token::SPEF_NETS);
+  if (!location.was_read && !msgs.empty()) {
+    LockGuard lock(net_msgs_lock_);
+    net_msgs_[location.line] = std::move(msgs);
+  }
+}
+
+void
+SpefLazyReader::reportMessages()
+{
+  // fileError throws, so take the messages before reporting them.
+  std::map<int, SpefMsgSeq> net_msgs;
+  {
+    LockGuard lock(net_msgs_lock_);
+    net_msgs.swap(net_msgs_);
+  }
+  for (const auto &[line, msgs] : net_msgs) {
+    for (const SpefMsg &msg : msgs) {
+      if (msg.is_error)
+        reader_.report_->fileError(msg.id, filename_, msg.line, "{}", msg.msg);
+      else
+        reader_.report_->fileWarn(msg.id, filename_, msg.line, "{}", msg.msg);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////
+
 SpefTriple::SpefTriple(float value) :
   is_triple_(false)
 {
@@ -570,23 +956,4 @@ SpefTriple::value(int index) const
     return values_[0];
 }
 
-////////////////////////////////////////////////////////////////
-
-SpefScanner::SpefScanner(std::istream *stream,
-                         std::string_view filename,
-                         SpefReader *reader,
-                         Report *report) :
-  yyFlexLexer(stream),
-  filename_(filename),
-  reader_(reader),
-  report_(report)
-{
-}
-
-void
-SpefScanner::error(std::string_view msg)
-{
-  report_->fileError(1658, filename_, lineno(), "{}", msg);
-}
-
 }  // namespace sta
@@ -42,6 +42,8 @@ class StaState;
 // Read a file single value parasitics into analysis point ap.
 // In a Spef file with triplet values the first value is used.
 // Min/max and operating condition op_cond are used for parasitic network reduction.
+// With lazy, *D_NET parasitic networks are read from the file when
+// they are first needed instead of when the file is read.
 // Return true if successful.
 bool
 readSpefFile(std::string_view filename,
@@ -50,6 +52,7 @@ readSpefFile(std::string_view filename,
              bool keep_coupling_caps,
              float coupling_cap_factor,
              bool reduce,
+             bool lazy,
              const Scene *scene,
              const MinMaxAll *min_max,
              Parasitics *parasitics,
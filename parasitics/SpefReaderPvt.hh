@@ -25,25 +25,57 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
 
+#include "ConcreteParasitics.hh"
 #include "NetworkClass.hh"
 #include "ParasiticsClass.hh"
 #include "StaState.hh"
 #include "StringUtil.hh"
-#include "Zlib.hh"
 
 namespace sta {
 
 class Report;
+class FileBuffer;
 class MinMaxAll;
 class SpefRspfPi;
 class SpefTriple;
 class Scene;
 class SpefScanner;
 
-using SpefNameMap = std::map<int, std::string>;
+// *NAME_MAP entries indexed by the integer after the '*'.
+class SpefNameMap
+{
+public:
+  void insert(size_t index,
+              std::string_view name);
+  // nullptr if there is no entry for index.
+  const std::string *find(size_t index) const;
+
+private:
+  // Indices are normally dense starting at 1.
+  std::vector<std::string> dense_;
+  // Entries with indices too large for dense_, so one huge index
+  // does not allocate a huge vector.
+  std::map<size_t, std::string> sparse_;
+
+  static constexpr size_t dense_min_ = 1 << 20;
+};
+
+// Warning or error saved by a thread reading part of a file.
+struct SpefMsg
+{
+  int id;
+  int line;
+  bool is_error;
+  std::string msg;
+};
+
+using SpefMsgSeq = std::vector<SpefMsg>;
 
 class SpefReader : public StaState
 {
@@ -54,6 +86,7 @@ public:
              bool keep_coupling_caps,
              float coupling_cap_factor,
              bool reduce,
+             bool lazy,
              const Scene *scene,
              const MinMaxAll *min_max,
              Parasitics *parasitics,
@@ -112,11 +145,34 @@ public:
             std::string_view fmt,
             Args &&...args)
   {
-    report_->fileWarn(id, filename_, warnLine(), fmt,
-                     std::forward<Args>(args)...);
+    if (deferred_msgs_) {
+      if (!report_->isSuppressed(id))
+        deferred_msgs_->push_back({id, warnLine(), false,
+            sta::vformat(fmt, sta::make_format_args(args...))});
+    }
+    else
+      report_->fileWarn(id, filename_, warnLine(), fmt,
+                        std::forward<Args>(args)...);
   }
+  // Syntax errors from the scanner and parser.
+  void error(int id,
+             int line,
+             std::string_view msg);
 
 private:
+  bool parse(std::string_view text,
+             int line,
+             int start_token);
+  bool parse(SpefScanner &scanner);
+  bool readCompressed();
+  bool readParallel(std::string_view text);
+  bool readLazy(std::unique_ptr<FileBuffer> buffer,
+                ConcreteParasitics *parasitics);
+  bool findDspfNet(std::string_view section,
+                   int line,
+                   Net *&net);
+  static size_t findNetStart(std::string_view text,
+                             size_t from);
   Pin *findPinRelative(std::string_view name);
   Pin *findPortPinRelative(std::string_view name);
   Net *findNetRelative(std::string_view name);
@@ -125,12 +181,13 @@ private:
                                    bool local_only);
 
   std::string_view filename_;
-  SpefScanner *scanner_;
+  SpefScanner *scanner_{nullptr};
   Instance *instance_;
   bool pin_cap_included_;
   bool keep_coupling_caps_;
   bool coupling_cap_factor_;
   bool reduce_;
+  bool lazy_;
   const Scene *scene_;
   const MinMaxAll *min_max_;
   // Normally no need to keep device names.
@@ -145,10 +202,47 @@ private:
   float cap_scale_{1.0};
   float res_scale_{1.0};
   float induct_scale_{1.0};
-  SpefNameMap name_map_;
+  // Shared by the copies of the reader that read nets in parallel.
+  std::shared_ptr<SpefNameMap> name_map_;
   StringSeq design_flow_;
   Parasitics *parasitics_;
   Parasitic *parasitic_{nullptr};
+  // Messages are saved here instead of reported when reading nets
+  // in parallel so they are reported in file order by the main thread.
+  SpefMsgSeq *deferred_msgs_{nullptr};
+  // Network to fill in with the next *D_NET when reading a lazy
+  // parasitic network.
+  Parasitic *lazy_parasitic_{nullptr};
+
+  // Parallel reads split the nets into this many chunks per thread
+  // to balance uneven net sizes.
+  static constexpr size_t chunks_per_thread_ = 8;
+
+  friend class SpefLazyReader;
+};
+
+// Reads *D_NET sections of a file indexed by SpefReader::readLazy
+// with a copy of the reader state at the end of the header.
+class SpefLazyReader : public LazyParasiticNetworkReader
+{
+public:
+  SpefLazyReader(const SpefReader &reader,
+                 std::unique_ptr<FileBuffer> buffer);
+  ~SpefLazyReader() override;
+  void readNetwork(const Net *net,
+                   const LazyParasiticNetwork &location,
+                   Parasitic *parasitic) override;
+  bool includesPinCaps() const override;
+  void reportMessages() override;
+
+private:
+  std::string filename_;
+  std::unique_ptr<FileBuffer> buffer_;
+  SpefReader reader_;
+  // Messages from the first read of each network indexed by the line
+  // of its *D_NET, so they are reported in file order.
+  std::map<int, SpefMsgSeq> net_msgs_;
+  std::mutex net_msgs_lock_;
 };
 
 class SpefTriple
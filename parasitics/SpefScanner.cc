@@ -0,0 +1,620 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "parasitics/SpefScanner.hh"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "FileBuffer.hh"
+#include "parasitics/SpefReaderPvt.hh"
+
+namespace sta {
+
+using token = SpefParse::token;
+
+struct SpefKeyword
+{
+  std::string_view name;
+  int token;
+};
+
+// Keywords without the leading '*', sorted so keywords with the same
+// first letter are together.
+static constexpr SpefKeyword spef_keywords[] = {
+  {"BUS_DELIMITER", token::BUS_DELIMITER},
+  {"C", token::KW_C},
+  {"C2_R1_C1", token::C2_R1_C1},
+  {"CAP", token::CAP},
+  {"CELL", token::CELL},
+  {"CONN", token::CONN},
+  {"C_UNIT", token::C_UNIT},
+  {"D", token::KW_D},
+  {"DATE", token::DATE},
+  {"DEFINE", token::DEFINE},
+  {"DELIMITER", token::DELIMITER},
+  {"DESIGN", token::DESIGN},
+  {"DESIGN_FLOW", token::DESIGN_FLOW},
+  {"DIVIDER", token::DIVIDER},
+  {"DRIVER", token::DRIVER},
+  {"D_NET", token::D_NET},
+  {"D_PNET", token::D_PNET},
+  {"END", token::END},
+  {"GROUND_NETS", token::GROUND_NETS},
+  {"I", token::KW_I},
+  {"INDUC", token::INDUC},
+  {"K", token::KW_K},
+  {"L", token::KW_L},
+  {"LOADS", token::LOADS},
+  {"L_UNIT", token::L_UNIT},
+  {"N", token::KW_N},
+  {"NAME_MAP", token::NAME_MAP},
+  {"P", token::KW_P},
+  {"PDEFINE", token::PDEFINE},
+  {"PHYSICAL_PORTS", token::PHYSICAL_PORTS},
+  {"PORTS", token::PORTS},
+  {"POWER_NETS", token::POWER_NETS},
+  {"PROGRAM", token::PROGRAM},
+  {"Q", token::KW_Q},
+  {"RC", token::RC},
+  {"RES", token::RES},
+  {"R_NET", token::R_NET},
+  {"R_PNET", token::R_PNET},
+  {"R_UNIT", token::R_UNIT},
+  {"S", token::KW_S},
+  {"SPEF", token::SPEF},
+  {"T_UNIT", token::T_UNIT},
+  {"V", token::KW_V},
+  {"VENDOR", token::VENDOR},
+  {"VERSION", token::PVERSION},
+};
+
+static_assert(std::ranges::is_sorted(spef_keywords, {}, &SpefKeyword::name));
+
+static bool
+isAlpha(char ch)
+{
+  return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z');
+}
+
+static bool
+isDigit(char ch)
+{
+  return ch >= '0' && ch <= '9';
+}
+
+static bool
+isHchar(char ch)
+{
+  return ch == '.' || ch == '/' || ch == '|' || ch == ':';
+}
+
+static bool
+isEscapedChar(char ch)
+{
+  return ch != '\0' && strchr("#$%&`()*+,-./:;<=>?@[\\]^'{|}~\"", ch);
+}
+
+static bool
+isPrefixBusDelim(char ch)
+{
+  return ch == '[' || ch == '{' || ch == '(' || ch == '<';
+}
+
+static bool
+isSuffixBusDelim(char ch)
+{
+  return ch == ']' || ch == '}' || ch == ')' || ch == '>';
+}
+
+static bool
+isBusSub(char ch)
+{
+  return isDigit(ch) || isAlpha(ch) || ch == '_';
+}
+
+// Same conversions as atoi/atof on a token that is not null terminated.
+static int
+tokenInt(std::string_view text)
+{
+  if (!text.empty() && text[0] == '+')
+    text.remove_prefix(1);
+  int value = 0;
+  std::from_chars(text.data(), text.data() + text.size(), value);
+  return value;
+}
+
+static float
+tokenFloat(std::string_view text)
+{
+  char buffer[64];
+  if (text.size() < sizeof(buffer)) {
+    memcpy(buffer, text.data(), text.size());
+    buffer[text.size()] = '\0';
+    return static_cast<float>(atof(buffer));
+  }
+  else
+    return static_cast<float>(atof(std::string(text).c_str()));
+}
+
+////////////////////////////////////////////////////////////////
+
+SpefScanner::SpefScanner(std::string_view text,
+                         int line,
+                         SpefReader *reader) :
+  pos_(text.data()),
+  end_(text.data() + text.size()),
+  line_(line),
+  reader_(reader)
+{
+}
+
+SpefScanner::SpefScanner(CompressedFileWindow *window,
+                         SpefReader *reader) :
+  pos_(nullptr),
+  end_(nullptr),
+  window_(window),
+  line_(1),
+  reader_(reader)
+{
+}
+
+// Inflate more of a compressed file keeping the text from pos_ on.
+// Return false at the end of the file.
+bool
+SpefScanner::refill()
+{
+  if (window_ == nullptr)
+    return false;
+  size_t kept = end_ - pos_;
+  std::string_view text = window_->refill(pos_);
+  pos_ = text.data();
+  end_ = text.data() + text.size();
+  return text.size() > kept;
+}
+
+// Refill and move p, which points into the window after pos_.
+bool
+SpefScanner::refill(const char *&p)
+{
+  size_t offset = p - pos_;
+  bool more = refill();
+  p = pos_ + offset;
+  return more;
+}
+
+void
+SpefScanner::error(std::string_view msg)
+{
+  reader_->error(1658, line_, msg);
+}
+
+void
+SpefScanner::setStartToken(int tok)
+{
+  start_token_ = tok;
+}
+
+int
+SpefScanner::lex(SpefParse::semantic_type *yylval,
+                 SpefParse::location_type *loc)
+{
+  if (start_token_) {
+    int tok = start_token_;
+    start_token_ = 0;
+    return tok;
+  }
+  while (pos_ < end_ || refill()) {
+    loc->step();
+    char ch = *pos_;
+    switch (ch) {
+    case '\n':
+      pos_++;
+      line_++;
+      loc->lines();
+      break;
+    case ' ':
+    case '\t':
+    case '\r':
+      pos_++;
+      loc->columns(1);
+      break;
+    case '/':
+      if (pos_ + 1 < end_ && (pos_[1] == '/' || pos_[1] == '*')) {
+        if (!skipComment(loc))
+          return 0;
+      }
+      else
+        return token(ch, 1, loc);
+      break;
+    case '"':
+      return lexQuote(yylval, loc);
+    case '*':
+      return lexStar(yylval, loc);
+    default:
+      return lexWord(yylval, loc);
+    }
+  }
+  return 0;
+}
+
+// Advance past the token and return it.
+int
+SpefScanner::token(int tok,
+                   size_t length,
+                   SpefParse::location_type *loc)
+{
+  pos_ += length;
+  loc->columns(length);
+  return tok;
+}
+
+// Return false for an unterminated comment.
+bool
+SpefScanner::skipComment(SpefParse::location_type *loc)
+{
+  if (pos_[1] == '/') {
+    // Single line comment.
+    const char *eol = static_cast<const char *>(memchr(pos_, '\n', end_ - pos_));
+    if (eol) {
+      pos_ = eol + 1;
+      line_++;
+      loc->lines();
+    }
+    else
+      pos_ = end_;
+  }
+  else {
+    for (const char *p = pos_ + 2; p < end_ || refill(p); p++) {
+      if (*p == '\n') {
+        line_++;
+        loc->lines();
+      }
+      else if (*p == '*' && p + 1 < end_ && p[1] == '/') {
+        pos_ = p + 2;
+        return true;
+      }
+    }
+    pos_ = end_;
+    error("unterminated comment");
+    return false;
+  }
+  return true;
+}
+
+int
+SpefScanner::lexQuote(SpefParse::semantic_type *yylval,
+                      SpefParse::location_type *loc)
+{
+  std::string str;
+  const char *p = pos_ + 1;
+  while (p < end_ || refill(p)) {
+    char ch = *p;
+    if (ch == '"') {
+      pos_ = p + 1;
+      yylval->emplace<std::string>(std::move(str));
+      return token::QSTRING;
+    }
+    else if (ch == '\n'
+             || (ch == '\r' && p + 1 < end_ && p[1] == '\n')) {
+      p += (ch == '\r') ? 2 : 1;
+      line_++;
+      loc->lines();
+    }
+    else if (ch == '\\' && p + 1 < end_ && p[1] != '\n') {
+      str += p[1];
+      p += 2;
+    }
+    else {
+      str += ch;
+      p++;
+    }
+  }
+  pos_ = end_;
+  error("unterminated quoted string");
+  return 0;
+}
+
+// Keywords, name map indices and names that start with an index.
+int
+SpefScanner::lexStar(SpefParse::semantic_type *yylval,
+                     SpefParse::location_type *loc)
+{
+  size_t index_length = matchIndex(pos_);
+  if (index_length > 0) {
+    const char *hchar = pos_ + index_length;
+    if (hchar < end_ && isHchar(*hchar)) {
+      size_t tail_length = matchNamePairTail(hchar + 1);
+      if (tail_length > 0) {
+        size_t length = index_length + 1 + tail_length;
+        yylval->emplace<std::string>(reader_->translated(std::string_view(pos_,
+                                                                          length)));
+        return token(token::NAME, length, loc);
+      }
+    }
+    yylval->emplace<std::string>(pos_, index_length);
+    return token(token::INDEX, index_length, loc);
+  }
+  // The longest keyword that prefixes the text after the '*'.
+  // Only the keywords with the same first letter are checked.
+  std::string_view text(pos_ + 1, end_ - pos_ - 1);
+  const SpefKeyword *keyword = nullptr;
+  if (!text.empty()) {
+    auto first_letter = [] (const SpefKeyword &kw) { return kw.name[0]; };
+    for (const SpefKeyword &kw : std::ranges::equal_range(spef_keywords, text[0],
+                                                          {}, first_letter)) {
+      if (text.starts_with(kw.name)
+          && (keyword == nullptr || kw.name.size() > keyword->name.size()))
+        keyword = &kw;
+    }
+  }
+  if (keyword)
+    return token(keyword->token, keyword->name.size() + 1, loc);
+  else
+    return token('*', 1, loc);
+}
+
+// Numbers, identifiers and names. Like flex, the longest match wins
+// and ties go to the number rules before the identifier rules.
+int
+SpefScanner::lexWord(SpefParse::semantic_type *yylval,
+                     SpefParse::location_type *loc)
+{
+  char ch = *pos_;
+  bool is_float = false;
+  size_t number_length = 0;
+  if (isDigit(ch) || ch == '+' || ch == '-' || ch == '.')
+    number_length = matchNumber(pos_, is_float);
+  size_t ident_length = matchIdent(pos_);
+  // A name pair is only longer than the identifier when it ends with a
+  // hierarchy character followed by an index.
+  size_t name_length = 0;
+  size_t path_length = 0;
+  if (ident_length > 0
+      && isHchar(pos_[ident_length - 1])
+      && pos_ + ident_length < end_
+      && pos_[ident_length] == '*')
+    path_length = matchPath(pos_);
+  if (path_length > 0) {
+    const char *hchar = pos_ + path_length;
+    if (hchar < end_ && isHchar(*hchar)) {
+      size_t tail_length = matchNamePairTail(hchar + 1);
+      if (tail_length > 0)
+        name_length = path_length + 1 + tail_length;
+    }
+  }
+
+  if (number_length > 0
+      && number_length >= ident_length
+      && number_length >= name_length) {
+    std::string_view text(pos_, number_length);
+    if (is_float)
+      yylval->emplace<float>(tokenFloat(text));
+    else
+      yylval->emplace<int>(tokenInt(text));
+    return token(is_float ? token::FLOAT : token::INTEGER, number_length, loc);
+  }
+  else if (ident_length > 0 && ident_length >= name_length) {
+    std::string_view text(pos_, ident_length);
+    yylval->emplace<std::string>(reader_->translated(text));
+    return token(token::IDENT, ident_length, loc);
+  }
+  else if (name_length > 0) {
+    std::string_view text(pos_, name_length);
+    yylval->emplace<std::string>(reader_->translated(text));
+    return token(token::NAME, name_length, loc);
+  }
+  else
+    // Hierarchy characters and out of bound characters go to the parser.
+    return token(static_cast<unsigned char>(ch), 1, loc);
+}
+
+////////////////////////////////////////////////////////////////
+
+// The match functions return the length of the longest match for the
+// corresponding flex definition at p, or zero.
+
+// IDENT_ACHAR {ESCAPED_CHAR}|{ALPHA}|"_"
+size_t
+SpefScanner::identAChar(const char *p) const
+{
+  if (p < end_) {
+    char ch = *p;
+    if (isAlpha(ch) || ch == '_')
+      return 1;
+    if (ch == '\\' && p + 1 < end_ && isEscapedChar(p[1]))
+      return 2;
+  }
+  return 0;
+}
+
+// IDENT_CHAR {IDENT_ACHAR}|{DIGIT}|"!"
+size_t
+SpefScanner::identChar(const char *p) const
+{
+  size_t length = identAChar(p);
+  if (length == 0 && p < end_ && (isDigit(*p) || *p == '!'))
+    length = 1;
+  return length;
+}
+
+size_t
+SpefScanner::matchDigits(const char *p) const
+{
+  const char *q = p;
+  while (q < end_ && isDigit(*q))
+    q++;
+  return q - p;
+}
+
+// INTEGER {SIGN}?{DIGIT}+
+size_t
+SpefScanner::matchInteger(const char *p) const
+{
+  size_t sign = (p < end_ && (*p == '+' || *p == '-')) ? 1 : 0;
+  size_t digits = matchDigits(p + sign);
+  return digits > 0 ? sign + digits : 0;
+}
+
+// INTEGER or FLOAT. is_float is set for decimals, fractions and exponents.
+size_t
+SpefScanner::matchNumber(const char *p,
+                         bool &is_float) const
+{
+  size_t length = (p < end_ && (*p == '+' || *p == '-')) ? 1 : 0;
+  size_t int_digits = matchDigits(p + length);
+  length += int_digits;
+  is_float = false;
+  if (p + length < end_ && p[length] == '.') {
+    size_t frac_digits = matchDigits(p + length + 1);
+    if (int_digits > 0 || frac_digits > 0) {
+      length += 1 + frac_digits;
+      is_float = true;
+    }
+  }
+  if (int_digits == 0 && !is_float)
+    return 0;
+  if (p + length < end_ && (p[length] == 'e' || p[length] == 'E')) {
+    size_t exp_length = matchInteger(p + length + 1);
+    if (exp_length > 0) {
+      length += 1 + exp_length;
+      is_float = true;
+    }
+  }
+  return length;
+}
+
+// ID {IDENT_ACHAR}{IDENT_CHAR}*
+size_t
+SpefScanner::matchId(const char *p) const
+{
+  size_t length = identAChar(p);
+  if (length > 0) {
+    while (size_t char_length = identChar(p + length))
+      length += char_length;
+  }
+  return length;
+}
+
+// ID_OR_BIT {ID}|{ID}({PREFIX_BUS_DELIM}{BUS_SUB}+{SUFFIX_BUS_DELIM})+
+size_t
+SpefScanner::matchIdOrBit(const char *p) const
+{
+  size_t length = matchId(p);
+  if (length > 0) {
+    while (true) {
+      const char *q = p + length;
+      if (q < end_ && isPrefixBusDelim(*q)) {
+        size_t sub = 1;
+        while (q + sub < end_ && isBusSub(q[sub]))
+          sub++;
+        if (sub > 1 && q + sub < end_ && isSuffixBusDelim(q[sub])) {
+          length += sub + 1;
+          continue;
+        }
+      }
+      break;
+    }
+  }
+  return length;
+}
+
+// IDENT {INTEGER}*{ID_OR_BIT}({HCHAR}|{INTEGER}|{ID_OR_BIT})*
+size_t
+SpefScanner::matchIdent(const char *p) const
+{
+  size_t length = 0;
+  while (size_t int_length = matchInteger(p + length))
+    length += int_length;
+  size_t id_length = matchIdOrBit(p + length);
+  if (id_length == 0)
+    return 0;
+  length += id_length;
+  while (true) {
+    const char *q = p + length;
+    size_t elem_length = 0;
+    if (q < end_ && isHchar(*q))
+      elem_length = 1;
+    else {
+      elem_length = matchIdOrBit(q);
+      if (elem_length == 0)
+        elem_length = matchInteger(q);
+    }
+    if (elem_length == 0)
+      break;
+    length += elem_length;
+  }
+  return length;
+}
+
+// PATH {IDENT_OR_BIT}({HCHAR}{IDENT_OR_BIT})*
+size_t
+SpefScanner::matchPath(const char *p) const
+{
+  size_t length = matchIdOrBit(p);
+  if (length > 0) {
+    while (true) {
+      const char *q = p + length;
+      if (q < end_ && isHchar(*q)) {
+        size_t elem_length = matchIdOrBit(q + 1);
+        if (elem_length > 0) {
+          length += 1 + elem_length;
+          continue;
+        }
+      }
+      break;
+    }
+  }
+  return length;
+}
+
+// INDEX "*"{POS_INTEGER}
+size_t
+SpefScanner::matchIndex(const char *p) const
+{
+  if (p < end_ && *p == '*') {
+    size_t digits = matchDigits(p + 1);
+    if (digits > 0)
+      return 1 + digits;
+  }
+  return 0;
+}
+
+// The part of NAME_PAIR after the hierarchy character.
+// {INDEX}|{IDENT_OR_BIT}|{POS_INTEGER}
+size_t
+SpefScanner::matchNamePairTail(const char *p) const
+{
+  size_t length = matchIndex(p);
+  if (length == 0)
+    length = matchIdOrBit(p);
+  if (length == 0)
+    length = matchDigits(p);
+  return length;
+}
+
+} // namespace sta
@@ -24,44 +24,71 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string_view>
 
 #include "SpefLocation.hh"
 #include "SpefParse.hh"
 
-#ifndef __FLEX_LEXER_H
-#undef yyFlexLexer
-#define yyFlexLexer SpefFlexLexer
-#include <FlexLexer.h>
-#endif
-
 namespace sta {
 
-class Report;
+class CompressedFileWindow;
 
-class SpefScanner : public SpefFlexLexer
+// Hand written spef tokenizer that walks a file held in memory.
+// Tokens are string views into the buffer until they are handed to
+// the parser, so there is no per character copying or stream buffering.
+// The token rules are the same as the flex scanner it replaces.
+// Compressed files are scanned through a window that is refilled when
+// the scanner reaches its end. Only quoted strings and comments span
+// lines, so they are the only tokens that refill the window.
+class SpefScanner
 {
 public:
-  SpefScanner(std::istream *stream,
-              std::string_view filename,
-              SpefReader *reader,
-              Report *report);
-  virtual int lex(SpefParse::semantic_type *yylval,
-                  SpefParse::location_type *yylloc);
-  // YY_DECL defined in SpefLex.ll
-  // Method body created by flex in SpefLex.cc
-
+  // line is the line number of the start of text.
+  SpefScanner(std::string_view text,
+              int line,
+              SpefReader *reader);
+  SpefScanner(CompressedFileWindow *window,
+              SpefReader *reader);
+  int lex(SpefParse::semantic_type *yylval,
+          SpefParse::location_type *yylloc);
   void error(std::string_view msg);
-  int line() const {  return yylineno; }
-
-  // Get rid of override virtual function warning.
-  using FlexLexer::yylex;
+  int line() const { return line_; }
+  // Token returned before the first token of the text.
+  void setStartToken(int tok);
 
 private:
-  std::string_view filename_;
+  bool refill();
+  bool refill(const char *&p);
+  int lexQuote(SpefParse::semantic_type *yylval,
+               SpefParse::location_type *loc);
+  int lexStar(SpefParse::semantic_type *yylval,
+              SpefParse::location_type *loc);
+  int lexWord(SpefParse::semantic_type *yylval,
+              SpefParse::location_type *loc);
+  bool skipComment(SpefParse::location_type *loc);
+  int token(int tok,
+            size_t length,
+            SpefParse::location_type *loc);
+  size_t identAChar(const char *p) const;
+  size_t identChar(const char *p) const;
+  size_t matchDigits(const char *p) const;
+  size_t matchInteger(const char *p) const;
+  size_t matchNumber(const char *p,
+                     bool &is_float) const;
+  size_t matchId(const char *p) const;
+  size_t matchIdOrBit(const char *p) const;
+  size_t matchIdent(const char *p) const;
+  size_t matchPath(const char *p) const;
+  size_t matchIndex(const char *p) const;
+  size_t matchNamePairTail(const char *p) const;
+
+  const char *pos_;
+  const char *end_;
+  CompressedFileWindow *window_{nullptr};
+  int line_;
+  int start_token_{0};
   SpefReader *reader_;
-  Report *report_;
-  std::string token_;
 };
 
 } // namespace sta
@@ -489,15 +489,12 @@ Power::powerInside(const Instance *hinst,
                    const Scene *scene,
                    PowerResult &result)
 {
-  InstanceChildIterator *child_iter = network_->childIterator(hinst);
-  while (child_iter->hasNext()) {
-    Instance *child = child_iter->next();
+  network_->visitChildren(hinst, [&](Instance *child) {
     if (network_->isHierarchical(child))
       powerInside(child, scene, result);
     else
       result.incr(instance_powers_[child]);
-  }
-  delete child_iter;
+  });
 }
 
 ////////////////////////////////////////////////////////////////
@@ -778,9 +775,7 @@ Power::clockGatePins(const Instance *inst,
   enable = nullptr;
   clk = nullptr;
   gclk = nullptr;
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    const Pin *pin = pin_iter->next();
+  network_->visitPins(inst, [&](const Pin *pin) {
     const LibertyPort *port = network_->libertyPort(pin);
     if (port->isClockGateEnable())
       enable = pin;
@@ -788,8 +783,7 @@ Power::clockGatePins(const Instance *inst,
       clk = pin;
     if (port->isClockGateOut())
       gclk = pin;
-  }
-  delete pin_iter;
+  });
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1004,9 +998,7 @@ Power::seedRegOutputActivities(const Instance *inst,
     seedRegOutputActivities(inst, seq, seq.outputInv(), true);
     // Enqueue register output pins with functions that reference
     // the sequential internal pins (IQ, IQN).
-    InstancePinIterator *pin_iter = network_->pinIterator(inst);
-    while (pin_iter->hasNext()) {
-      Pin *pin = pin_iter->next();
+    network_->visitPins(inst, [&](Pin *pin) {
       LibertyPort *port = network_->libertyPort(pin);
       if (test_cell)
         port = test_cell->findLibertyPort(port->name());
@@ -1020,8 +1012,7 @@ Power::seedRegOutputActivities(const Instance *inst,
           bfs.enqueue(vertex);
         }
       }
-    }
-    delete pin_iter;
+    });
   }
 }
 
@@ -1067,17 +1058,14 @@ void
 Power::seedClkGateOutputActivities(const Instance *inst,
                                    BfsFwdIterator &bfs)
 {
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    Pin *pin = pin_iter->next();
+  network_->visitPins(inst, [&](Pin *pin) {
     LibertyPort *port = network_->libertyPort(pin);
     if (port && port->isClockGateOut()) {
       Vertex *vertex = graph_->pinDrvrVertex(pin);
       if (vertex)
         bfs.enqueue(vertex);
     }
-  }
-  delete pin_iter;
+  });
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1151,9 +1139,7 @@ Power::findInternalPower(const Instance *inst,
                          // Return values.
                          PowerResult &result)
 {
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    const Pin *to_pin = pin_iter->next();
+  network_->visitPins(inst, [&](const Pin *to_pin) {
     LibertyPort *to_port = network_->libertyPort(to_pin);
     if (to_port) {
       float load_cap = to_port->direction()->isAnyOutput()
@@ -1167,8 +1153,7 @@ Power::findInternalPower(const Instance *inst,
         findInputInternalPower(to_pin, to_port, inst, cell, activity, load_cap,
                                scene, result);
     }
-  }
-  delete pin_iter;
+  });
 }
 
 void
@@ -1468,9 +1453,7 @@ Power::findSwitchingPower(const Instance *inst,
                           PowerResult &result)
 {
   LibertyCell *scene_cell = cell->sceneCell(scene, MinMax::max());
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    const Pin *to_pin = pin_iter->next();
+  network_->visitPins(inst, [&](const Pin *to_pin) {
     const LibertyPort *to_port = network_->libertyPort(to_pin);
     if (to_port) {
       float load_cap = to_port->direction()->isAnyOutput()
@@ -1490,8 +1473,7 @@ Power::findSwitchingPower(const Instance *inst,
         result.incrSwitching(switching);
       }
     }
-  }
-  delete pin_iter;
+  });
 }
 
 ////////////////////////////////////////////////////////////////
@@ -1784,17 +1766,14 @@ void
 Power::findUnannotatedPins(const Instance *inst,
                            PinSeq &unannotated_pins)
 {
-  InstancePinIterator *pin_iter = network_->pinIterator(inst);
-  while (pin_iter->hasNext()) {
-    const Pin *pin = pin_iter->next();
+  network_->visitPins(inst, [&](const Pin *pin) {
     LibertyPort *liberty_port = sdc_network_->libertyPort(pin);
     if (!network_->direction(pin)->isInternal()
         && !network_->direction(pin)->isPowerGround()
         && !(liberty_port && liberty_port->isPwrGnd())
         && !user_activity_map_.contains(pin))
       unannotated_pins.push_back(pin);
-  }
-  delete pin_iter;
+  });
 }
 
 // leaf pins - internal pins - power/ground pins + top instance pins
@@ -1805,25 +1784,19 @@ Power::pinCount()
   LeafInstanceIterator *leaf_iter = network_->leafInstanceIterator();
   while (leaf_iter->hasNext()) {
     Instance *leaf = leaf_iter->next();
-    InstancePinIterator *pin_iter = network_->pinIterator(leaf);
-    while (pin_iter->hasNext()) {
-      const Pin *pin = pin_iter->next();
+    network_->visitPins(leaf, [&](const Pin *pin) {
       LibertyPort *liberty_port = sdc_network_->libertyPort(pin);
       if (!network_->direction(pin)->isInternal()
           && !network_->direction(pin)->isPowerGround()
           && !(liberty_port && liberty_port->isPwrGnd()))
         count++;
-    }
-    delete pin_iter;
+    });
   }
   delete leaf_iter;
 
-  InstancePinIterator *pin_iter = network_->pinIterator(network_->topInstance());
-  while (pin_iter->hasNext()) {
-    pin_iter->next();
+  network_->visitPins(network_->topInstance(), [&](Pin *) {
     count++;
-  }
-  delete pin_iter;
+  });
 
   return count;
 }
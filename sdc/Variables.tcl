@@ -251,6 +251,22 @@ proc trace_pin_name_compatibility { name1 name2 op } {
     pin_name_compatibility set_pin_name_compatibility
 }
 
+trace add variable ::sta_dataflow_propagation {read write} \
+  sta::trace_dataflow_propagation
+
+proc trace_dataflow_propagation { name1 name2 op } {
+  trace_boolean_var $op ::sta_dataflow_propagation \
+    dataflow_propagation set_dataflow_propagation
+}
+
+trace add variable ::sta_concurrent_modes {read write} \
+  sta::trace_concurrent_modes
+
+proc trace_concurrent_modes { name1 name2 op } {
+  trace_boolean_var $op ::sta_concurrent_modes \
+    concurrent_modes set_concurrent_modes
+}
+
 trace add variable ::sta_pocv_quantile {read write} \
   sta::trace_pocv_quantile
 
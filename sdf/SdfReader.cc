@@ -636,12 +636,9 @@ SdfReader::device(SdfTripleSeq *triples)
 {
   // Ignore non-incremental annotations in incremental only mode.
   if (!(is_incremental_only_ && !in_incremental_) && instance_) {
-    InstancePinIterator *pin_iter = network_->pinIterator(instance_);
-    while (pin_iter->hasNext()) {
-      Pin *to_pin = pin_iter->next();
+    network_->visitPins(instance_, [&](Pin *to_pin) {
       setDevicePinDelays(to_pin, triples);
-    }
-    delete pin_iter;
+    });
   }
   deleteTripleSeq(triples);
 }
@@ -24,10 +24,15 @@
 
 #include "Bfs.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+
 #include "Debug.hh"
 #include "DispatchQueue.hh"
 #include "Graph.hh"
 #include "Levelize.hh"
+#include "Machine.hh"
 #include "Mutex.hh"
 #include "Network.hh"
 #include "Report.hh"
@@ -157,6 +162,7 @@ BfsIterator::visitParallel(Level to_level,
   size_t thread_count = thread_count_;
   int visit_count = 0;
   if (!empty()) {
+    graph_->ensureAdjacency();
     if (thread_count == 1)
       visit_count = visit(to_level, visitor);
     else {
@@ -164,6 +170,10 @@ BfsIterator::visitParallel(Level to_level,
       visitors.reserve(thread_count_);
       for (size_t k = 0; k < thread_count_; k++)
         visitors.push_back(visitor->copy());
+      bool report_stats = debug_->check("bfs", 1);
+      size_t level_count = 0;
+      size_t inline_count = 0;
+      size_t steal_count = 0;
       while (levelLessOrEqual(first_level_, last_level_)
              && levelLessOrEqual(first_level_, to_level)) {
         VertexSeq &level_vertices = queue_[first_level_];
@@ -171,7 +181,11 @@ BfsIterator::visitParallel(Level to_level,
         incrLevel(first_level_);
         if (!level_vertices.empty()) {
           size_t vertex_count = level_vertices.size();
-          if (vertex_count < thread_count) {
+          double begin_time = report_stats ? elapsedRunTime() : 0.0;
+          size_t level_steals = 0;
+          // Small levels are not worth the dispatch and wait.
+          bool visit_inline = vertex_count < thread_count * min_vertices_per_thread_;
+          if (visit_inline) {
             for (Vertex *vertex : level_vertices) {
               if (vertex) {
                 checkLevel(vertex, level);
@@ -179,15 +193,18 @@ BfsIterator::visitParallel(Level to_level,
                 visitor->visit(vertex);
               }
             }
+            inline_count++;
           }
           else {
-            size_t from = 0;
-            size_t chunk_size = vertex_count / thread_count;
+            // Several chunks per thread so that threads that draw
+            // cheap vertices can steal from threads with expensive ones.
+            size_t grain_size = std::clamp(vertex_count
+                                           / (thread_count * chunks_per_thread_),
+                                           size_t(1), max_grain_size_);
             BfsIndex bfs_index = bfs_index_;
-            for (size_t k = 0; k < thread_count; k++) {
-              // Last thread gets the left overs.
-              size_t to = (k == thread_count - 1) ? vertex_count : from + chunk_size;
-              dispatch_queue_->dispatch([=, this](size_t) {
+            level_steals = dispatch_queue_->parallelFor(vertex_count, thread_count,
+                                                        grain_size,
+              [&, level, bfs_index](size_t k, size_t from, size_t to) {
                 for (size_t i = from; i < to; i++) {
                   Vertex *vertex = level_vertices[i];
                   if (vertex) {
@@ -197,14 +214,25 @@ BfsIterator::visitParallel(Level to_level,
                   }
                 }
               });
-              from = to;
-            }
-            dispatch_queue_->finishTasks();
+            steal_count += level_steals;
           }
+          if (report_stats)
+            debugPrint(debug_, "bfs", 1, "level {} {} vertices {} {:.3f}ms steals {}",
+                       level,
+                       vertex_count,
+                       visit_inline ? "inline" : "parallel",
+                       (elapsedRunTime() - begin_time) * 1e+3,
+                       level_steals);
           level_vertices.clear();
           visit_count += vertex_count;
+          level_count++;
         }
       }
+      debugPrint(debug_, "bfs", 1, "visited {} vertices {} levels {} inline steals {}",
+                 visit_count,
+                 level_count,
+                 inline_count,
+                 steal_count);
       for (VertexVisitor *visitor : visitors)
         delete visitor;
     }
@@ -216,6 +244,8 @@ void
 BfsIterator::enqueue(Vertex *vertex)
 {
   debugPrint(debug_, "bfs", 2, "enqueue {}", vertex->to_string(this));
+  if (dataflow_ && dataflowEnqueue(vertex))
+    return;
   if (!vertex->bfsInQueue(bfs_index_)) {
     Level level = vertex->level();
     LockGuard lock(queue_lock_);
@@ -435,6 +465,349 @@ BfsFwdIterator::enqueueAdjacentVertices(Vertex *vertex,
 
 ////////////////////////////////////////////////////////////////
 
+// Fanin counts and visit states for BfsFwdIterator::visitDataflow
+// indexed by VertexId. The arrays are kept between visits and only
+// the entries of the members are reset when a visit finishes.
+class BfsDataflow
+{
+public:
+  ~BfsDataflow();
+  // Only called between visits.
+  void ensureSize(VertexId id_bound);
+  [[nodiscard]] bool isMember(VertexId id) const;
+  void addMember(Vertex *vertex,
+                 VertexId id,
+                 bool queued);
+  const VertexSeq &members() const { return members_; }
+  void incrFanin(VertexId id);
+  [[nodiscard]] bool faninFinished(VertexId id) const;
+  // Return true if the fanin count drops to zero.
+  bool decrFanin(VertexId id);
+  // Claim the visit of a member.
+  // Return true if the member is queued so it should be visited.
+  bool start(VertexId id);
+  // Queue a member.
+  // Return true if its visit has already started, so it has to be
+  // queued to be visited again after the dataflow visit.
+  bool enqueue(VertexId id);
+  // Remove the members.
+  void clear(const Graph *graph);
+
+private:
+  // Visit states.
+  static constexpr uint8_t not_member_ = 0;
+  static constexpr uint8_t idle_ = 1;
+  static constexpr uint8_t queued_ = 2;
+  static constexpr uint8_t started_ = 3;
+  static constexpr uint8_t requeued_ = 4;
+
+  size_t size_{0};
+  std::atomic<int> *fanin_counts_{nullptr};
+  std::atomic<uint8_t> *states_{nullptr};
+  VertexSeq members_;
+};
+
+BfsDataflow::~BfsDataflow()
+{
+  delete [] fanin_counts_;
+  delete [] states_;
+}
+
+void
+BfsDataflow::ensureSize(VertexId id_bound)
+{
+  if (id_bound > size_) {
+    delete [] fanin_counts_;
+    delete [] states_;
+    // Room for the vertices made by incremental updates.
+    size_ = id_bound + id_bound / 4;
+    fanin_counts_ = new std::atomic<int>[size_];
+    states_ = new std::atomic<uint8_t>[size_];
+    for (size_t i = 0; i < size_; i++) {
+      fanin_counts_[i].store(0, std::memory_order_relaxed);
+      states_[i].store(not_member_, std::memory_order_relaxed);
+    }
+  }
+}
+
+bool
+BfsDataflow::isMember(VertexId id) const
+{
+  return id < size_
+    && states_[id].load(std::memory_order_relaxed) != not_member_;
+}
+
+void
+BfsDataflow::addMember(Vertex *vertex,
+                       VertexId id,
+                       bool queued)
+{
+  states_[id].store(queued ? queued_ : idle_, std::memory_order_relaxed);
+  members_.push_back(vertex);
+}
+
+void
+BfsDataflow::incrFanin(VertexId id)
+{
+  fanin_counts_[id].fetch_add(1, std::memory_order_relaxed);
+}
+
+bool
+BfsDataflow::faninFinished(VertexId id) const
+{
+  return fanin_counts_[id].load(std::memory_order_relaxed) == 0;
+}
+
+bool
+BfsDataflow::decrFanin(VertexId id)
+{
+  // acq_rel so the visitor writes of every fanin vertex are visible to
+  // the thread that visits the vertex.
+  return fanin_counts_[id].fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+bool
+BfsDataflow::start(VertexId id)
+{
+  return states_[id].exchange(started_, std::memory_order_acq_rel) == queued_;
+}
+
+bool
+BfsDataflow::enqueue(VertexId id)
+{
+  std::atomic<uint8_t> &state = states_[id];
+  uint8_t prev = state.load(std::memory_order_acquire);
+  while (true) {
+    if (prev == idle_) {
+      if (state.compare_exchange_weak(prev, queued_, std::memory_order_acq_rel))
+        return false;
+    }
+    else if (prev == started_) {
+      if (state.compare_exchange_weak(prev, requeued_, std::memory_order_acq_rel))
+        return true;
+    }
+    else
+      // Already queued.
+      return false;
+  }
+}
+
+void
+BfsDataflow::clear(const Graph *graph)
+{
+  for (Vertex *vertex : members_) {
+    VertexId id = graph->id(vertex);
+    fanin_counts_[id].store(0, std::memory_order_relaxed);
+    states_[id].store(not_member_, std::memory_order_relaxed);
+  }
+  members_.clear();
+}
+
+// Members that have not been visited yet are only marked as queued.
+// They are visited when their fanin is finished. The state transition
+// claims the enqueue, so each enqueue leads to one visit.
+bool
+BfsIterator::dataflowEnqueue(Vertex *vertex)
+{
+  VertexId id = graph_->id(vertex);
+  if (dataflow_->isMember(id)) {
+    vertex->setBfsInQueue(bfs_index_, true);
+    if (dataflow_->enqueue(id)) {
+      // Enqueued by something other than a fanin vertex after the
+      // visit started, so queue it to be visited again by level.
+      Level level = vertex->level();
+      LockGuard lock(queue_lock_);
+      vertex->setBfsInQueue(bfs_index_, true);
+      queue_[level].push_back(vertex);
+      if (levelLess(last_level_, level))
+        last_level_ = level;
+      if (levelLess(level, first_level_))
+        first_level_ = level;
+    }
+    return true;
+  }
+  return false;
+}
+
+int
+BfsFwdIterator::visitDataflow(Level to_level,
+                              VertexVisitor *visitor)
+{
+  size_t thread_count = thread_count_;
+  if (empty())
+    return 0;
+  graph_->ensureAdjacency();
+  if (thread_count == 1)
+    return visit(to_level, visitor);
+
+  if (dataflow_state_ == nullptr)
+    dataflow_state_ = std::make_unique<BfsDataflow>();
+  BfsDataflow &dataflow = *dataflow_state_;
+  dataflow.ensureSize(graph_->vertexIdBound());
+  VertexSeq ready;
+  size_t member_count = findDataflowFanout(to_level, dataflow, ready);
+  std::vector<VertexVisitor *> visitors;
+  visitors.reserve(thread_count);
+  for (size_t k = 0; k < thread_count; k++)
+    visitors.push_back(visitor->copy());
+
+  std::mutex ready_lock;
+  std::condition_variable ready_cv;
+  std::atomic<size_t> unfinished_count(member_count);
+  std::atomic<int> waiting_count(0);
+  std::atomic<int> visit_count(0);
+  dataflow_ = &dataflow;
+  for (size_t k = 0; k < thread_count; k++) {
+    dispatch_queue_->dispatch([&, k](int) {
+      VertexVisitor *task_visitor = visitors[k];
+      // Vertices made ready by this task are visited depth first by it
+      // unless other tasks are waiting for work.
+      VertexSeq task_ready;
+      int task_visit_count = 0;
+      while (true) {
+        Vertex *vertex = nullptr;
+        if (!task_ready.empty()) {
+          vertex = task_ready.back();
+          task_ready.pop_back();
+        }
+        else {
+          std::unique_lock<std::mutex> lock(ready_lock);
+          waiting_count++;
+          ready_cv.wait(lock, [&] {
+            return !ready.empty() || unfinished_count.load() == 0;
+          });
+          waiting_count--;
+          if (ready.empty())
+            break;
+          vertex = ready.back();
+          ready.pop_back();
+        }
+        if (visitDataflowVertex(vertex, task_visitor, dataflow, to_level,
+                                task_ready))
+          task_visit_count++;
+        if (task_ready.size() > 1 && waiting_count.load() > 0) {
+          std::unique_lock<std::mutex> lock(ready_lock);
+          ready.insert(ready.end(), task_ready.begin(), task_ready.end() - 1);
+          task_ready.erase(task_ready.begin(), task_ready.end() - 1);
+          lock.unlock();
+          ready_cv.notify_all();
+        }
+        if (unfinished_count.fetch_sub(1) == 1) {
+          std::unique_lock<std::mutex> lock(ready_lock);
+          lock.unlock();
+          ready_cv.notify_all();
+        }
+      }
+      visit_count += task_visit_count;
+    });
+  }
+  dispatch_queue_->finishTasks();
+  dataflow_ = nullptr;
+  dataflow.clear(graph_);
+  for (VertexVisitor *visitor : visitors)
+    delete visitor;
+
+  debugPrint(debug_, "bfs", 1, "dataflow visited {} of {} vertices",
+             visit_count.load(), member_count);
+  // Visit vertices that were enqueued outside of the dataflow fanout.
+  return visit_count + visitParallel(to_level, visitor);
+}
+
+// Move the queued vertices thru to_level into dataflow and find
+// the fanin counts of their fanout.
+size_t
+BfsFwdIterator::findDataflowFanout(Level to_level,
+                                   BfsDataflow &dataflow,
+                                   // Return value.
+                                   VertexSeq &ready)
+{
+  Level level = first_level_;
+  while (level <= last_level_ && level <= to_level) {
+    VertexSeq &level_vertices = queue_[level];
+    for (Vertex *vertex : level_vertices) {
+      if (vertex) {
+        checkLevel(vertex, level);
+        VertexId id = graph_->id(vertex);
+        if (!dataflow.isMember(id))
+          dataflow.addMember(vertex, id, true);
+      }
+    }
+    level_vertices.clear();
+    level++;
+  }
+  if (level <= last_level_)
+    first_level_ = level;
+  else {
+    first_level_ = level_max_;
+    last_level_ = level_min_;
+  }
+
+  // members grows as the fanout is found.
+  const VertexSeq &members = dataflow.members();
+  for (size_t i = 0; i < members.size(); i++) {
+    Vertex *vertex = members[i];
+    VertexOutEdgeIterator edge_iter(vertex, graph_);
+    while (edge_iter.hasNext()) {
+      Edge *edge = edge_iter.next();
+      Vertex *to_vertex = edge->to(graph_);
+      if (isDataflowEdge(vertex, to_vertex, to_level)) {
+        VertexId to_id = edge->to();
+        if (!dataflow.isMember(to_id))
+          dataflow.addMember(to_vertex, to_id, false);
+        dataflow.incrFanin(to_id);
+      }
+    }
+  }
+  // Visit the lowest levels first.
+  for (auto itr = members.rbegin(); itr != members.rend(); itr++) {
+    Vertex *vertex = *itr;
+    if (dataflow.faninFinished(graph_->id(vertex)))
+      ready.push_back(vertex);
+  }
+  return members.size();
+}
+
+// Edges that go against the level order (disabled loops, latch D->Q)
+// do not order visits, same as they do not order visits by level.
+bool
+BfsFwdIterator::isDataflowEdge(Vertex *from_vertex,
+                               Vertex *to_vertex,
+                               Level to_level) const
+{
+  Level level = to_vertex->level();
+  return level > from_vertex->level()
+    && level <= to_level;
+}
+
+// Visit vertex if it is in the queue and release its fanout.
+// Return true if the vertex is visited.
+bool
+BfsFwdIterator::visitDataflowVertex(Vertex *vertex,
+                                    VertexVisitor *visitor,
+                                    BfsDataflow &dataflow,
+                                    Level to_level,
+                                    // Return value.
+                                    VertexSeq &ready)
+{
+  bool visited = false;
+  if (dataflow.start(graph_->id(vertex))) {
+    vertex->setBfsInQueue(bfs_index_, false);
+    visitor->visit(vertex);
+    visited = true;
+  }
+  VertexOutEdgeIterator edge_iter(vertex, graph_);
+  while (edge_iter.hasNext()) {
+    Edge *edge = edge_iter.next();
+    Vertex *to_vertex = edge->to(graph_);
+    if (isDataflowEdge(vertex, to_vertex, to_level)
+        && dataflow.decrFanin(edge->to()))
+      ready.push_back(to_vertex);
+  }
+  return visited;
+}
+
+////////////////////////////////////////////////////////////////
+
 BfsBkwdIterator::BfsBkwdIterator(BfsIndex bfs_index,
                                  SearchPred *search_pred,
                                  StaState *sta) :
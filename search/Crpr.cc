@@ -218,14 +218,14 @@ CheckCrpr::findCrpr(const Path *src_clk_path,
   while (src_clk_path2->pin(this) != tgt_clk_path2->pin(this)) {
     int level_diff = src_level - tgt_level;
     if (level_diff >= 0) {
-      src_clk_path2 = src_clk_path2->prevPath();
+      src_clk_path2 = src_clk_path2->prevPath(this);
       if (src_clk_path2 == nullptr
           || src_clk_path2->isNull())
         break;
       src_level = src_clk_path2->vertex(this)->level();
     }
     if (level_diff <= 0) {
-      tgt_clk_path2 = tgt_clk_path2->prevPath();
+      tgt_clk_path2 = tgt_clk_path2->prevPath(this);
       if (tgt_clk_path2 == nullptr
           || tgt_clk_path2->isNull())
         break;
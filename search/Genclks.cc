@@ -798,14 +798,15 @@ Genclks::copyGenClkSrcPaths(Vertex *vertex,
 {
   auto itr = vertex_src_paths_map_.find(vertex);
   if (itr != vertex_src_paths_map_.end()) {
-    const std::vector<const Path *> &src_paths = itr->second;
-    for (const Path *path : src_paths) {
-      Path src_path = *path;
-      Path *prev_path = src_path.prevPath();
-      if (prev_path && !prev_path->isNull()) {
-        Path *prev_vpath = Path::vertexPath(prev_path, this);
-        src_path.setPrevPath(prev_vpath);
-      }
+    const std::vector<const PathCopy *> &src_paths = itr->second;
+    for (const PathCopy *path : src_paths) {
+      // Link the copy to the vertex path instead of the previous copy.
+      Path *prev_path = path->prevPath(this);
+      Path *prev_vpath = nullptr;
+      if (prev_path && !prev_path->isNull())
+        prev_vpath = Path::vertexPath(prev_path, this);
+      Path src_path(path->vertex(this), path->tag(this), path->arrival(),
+                    prev_vpath, path->prevEdge(this), path->prevArc(this), this);
       debugPrint(debug_, "genclk", 3, "vertex {} insert genclk {} src path {} {}s",
                  src_path.vertex(this)->to_string(this),
                  src_path.tag(this)->genClkSrcPathClk()->name(),
@@ -822,7 +823,7 @@ void
 Genclks::clearSrcPaths()
 {
   for (const auto& [vertex, paths] : vertex_src_paths_map_) {
-    for (const Path *path : paths)
+    for (const PathCopy *path : paths)
       delete path;
   }
   vertex_src_paths_map_.clear();
@@ -846,7 +847,8 @@ Genclks::recordSrcPaths(Clock *gclk)
   bool has_edges = !gclk->edges().empty();
 
   for (const Pin *gclk_pin : gclk->leafPins()) {
-    std::vector<Path> &src_paths = genclk_src_paths_[ClockPinPair(gclk, gclk_pin)];
+    std::vector<PathCopy> &src_paths =
+      genclk_src_paths_[ClockPinPair(gclk, gclk_pin)];
     src_paths.resize(path_count);
     Vertex *gclk_vertex = srcPath(gclk_pin);
     VertexPathIterator path_iter(gclk_vertex, this);
@@ -859,7 +861,7 @@ Genclks::recordSrcPaths(Clock *gclk)
         const RiseFall *rf = path->transition(this);
         bool inverting_path = (rf != src_clk_rf);
         size_t path_index = srcPathIndex(rf, path->minMax(this));
-        Path &src_path = src_paths[path_index];
+        PathCopy &src_path = src_paths[path_index];
         if ((!divide_by_1 || (inverting_path == invert))
             && (!has_edges || src_clk_rf == gclk->masterClkEdgeTr(rf))
             && (src_path.isNull()
@@ -868,26 +870,26 @@ Genclks::recordSrcPaths(Clock *gclk)
           debugPrint(debug_, "genclk", 2, "  {} insertion {} {} {}",
                      network_->pathName(gclk_pin), early_late->to_string(),
                      rf->shortName(), delayAsString(path->arrival(), this));
-          src_path = *path;
+          src_path = PathCopy(path, this);
         }
       }
     }
     // Record vertex->genclk src paths.
     bool found_src_paths = false;
     for (size_t path_index = 0; path_index < path_count; path_index++) {
-      Path &src_path = src_paths[path_index];
+      PathCopy &src_path = src_paths[path_index];
       if (!src_path.isNull()) {
         Path *prev_copy = &src_path;
-        const Path *p = src_path.prevPath();
+        const Path *p = src_path.prevPath(this);
         while (p) {
-          Path *copy = new Path(p);
+          PathCopy *copy = new PathCopy(p, this);
           copy->setIsEnum(true);
-          prev_copy->setPrevPath(copy);
+          prev_copy->setPrevPath(copy, this);
           prev_copy = copy;
 
           Vertex *vertex = p->vertex(this);
           vertex_src_paths_map_[vertex].push_back(copy);
-          p = p->prevPath();
+          p = p->prevPath(this);
         }
         found_src_paths = true;
       }
@@ -963,7 +965,7 @@ Genclks::srcPath(const Clock *gclk,
 {
   auto itr = genclk_src_paths_.find(ClockPinPair(gclk, src_pin));
   if (itr != genclk_src_paths_.end()) {
-    const std::vector<Path> &src_paths = itr->second;
+    const std::vector<PathCopy> &src_paths = itr->second;
     if (!src_paths.empty()) {
       size_t path_index = srcPathIndex(rf, min_max);
       const Path *src_path = &src_paths[path_index];
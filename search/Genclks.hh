@@ -56,8 +56,10 @@ public:
 };
 
 using GenclkInfoMap = std::map<Clock*, GenclkInfo*>;
-using GenclkSrcPathMap = std::map<ClockPinPair, std::vector<Path>, ClockPinPairLess>;
-using VertexGenclkSrcPathsMap = std::map<Vertex*, std::vector<const Path*>, VertexIdLess>;
+using GenclkSrcPathMap = std::map<ClockPinPair, std::vector<PathCopy>,
+                                 ClockPinPairLess>;
+using VertexGenclkSrcPathsMap = std::map<Vertex*, std::vector<const PathCopy*>,
+                                         VertexIdLess>;
 using VertexQueue = std::queue<Vertex*>;
 
 class Genclks : public StaState
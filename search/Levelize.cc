@@ -25,11 +25,12 @@
 #include "Levelize.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
-#include <deque>
 
 #include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Graph.hh"
 #include "GraphCmp.hh"
 #include "GraphDelayCalc.hh"
@@ -120,27 +121,29 @@ Levelize::findLevels()
   for (const Mode *mode : modes_)
     mode->sdc()->ensureInputDelayRefPinEdges();
 
+  VertexSeq vertices;
   VertexIterator vertex_iter(graph_);
   while (vertex_iter.hasNext()) {
     Vertex *vertex = vertex_iter.next();
     // findBackEdges() init
     vertex->setVisited(false);
     vertex->setOnPath(false);
-    // assignLevels init
     vertex->setLevel(-1);
+    vertices.push_back(vertex);
   }
 
   findRoots();
-  findBackEdges();
-  VertexSeq topo_sorted = findTopologicalOrder();
-  assignLevels(topo_sorted);
-
-  // Set level of stranded vertices (constants) to zero.
-  VertexIterator vertex_iter2(graph_);
-  while (vertex_iter2.hasNext()) {
-    Vertex *vertex = vertex_iter2.next();
-    if (vertex->level() == -1)
-      setLevel(vertex, 0);
+  std::vector<Level> levels;
+  // The topological sort doubles as loop detection. The DFS to find
+  // and break loops only runs when the sort cannot reach every vertex.
+  if (!findTopologicalLevels(vertices, level_space_, false, levels)) {
+    findBackEdges();
+    findTopologicalLevels(vertices, level_space_, false, levels);
+  }
+
+  for (Vertex *vertex : vertices) {
+    // Set level of stranded vertices (constants) to zero.
+    setLevel(vertex, std::max(levels[graph_->id(vertex)], 0));
     // cleanup
     vertex->setVisited(false);
     vertex->setOnPath(false);
@@ -149,6 +152,8 @@ Levelize::findLevels()
   levelized_ = true;
   levels_valid_ = true;
   stats.report("Levelize");
+  // Order the graph edge arrays by the new levels.
+  graph_->makeAdjacency();
 }
 
 void
@@ -338,82 +343,164 @@ Levelize::findUnvisitedVertices()
 
 ////////////////////////////////////////////////////////////////
 
-VertexSeq
-Levelize::findTopologicalOrder()
+// Kahn topological sort that assigns each vertex the longest path
+// level from the roots. Vertices are visited one frontier at a time
+// and each frontier is split across threads. The fanin counts and
+// levels are atomic so the fanin of a vertex can be visited by
+// different threads. A vertex is visited after all of its fanin so
+// the levels are the same for any thread count.
+// With keep_levels the levels start at the current vertex levels so
+// they are only raised (incremental relevelization).
+// Returns false if a loop kept some vertices from being visited.
+bool
+Levelize::findTopologicalLevels(const VertexSeq &vertices,
+                                Level level_space,
+                                bool keep_levels,
+                                // Return value.
+                                std::vector<Level> &levels)
 {
   Stats stats(debug_, report_);
-  std::map<Vertex *, int> in_degree;
-
-  VertexIterator vertex_iter(graph_);
-  while (vertex_iter.hasNext()) {
-    Vertex *vertex = vertex_iter.next();
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      Vertex *to_vertex = edge->to(graph_);
-      if (searchThru(edge))
-        in_degree[to_vertex] += 1;
-    }
-    // Levelize bidirect driver as if it was a fanout of the bidirect load.
-    const Pin *pin = vertex->pin();
-    if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
-        && !vertex->isBidirectDriver()) {
-      Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-      ;
-      in_degree[to_vertex] += 1;
+  VertexId id_bound = graph_->vertexIdBound();
+  std::vector<std::atomic<int>> fanin_counts(id_bound);
+  std::vector<std::atomic<Level>> vertex_levels(id_bound);
+  size_t vertex_count = vertices.size();
+  size_t thread_count = thread_count_;
+  bool parallel = thread_count > 1
+    && vertex_count >= thread_count * levelize_grain_size_;
+
+  auto countFanin = [&](size_t from,
+                        size_t to) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = vertices[i];
+      VertexOutEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+        Edge *edge = edge_iter.next();
+        if (searchThru(edge)) {
+          Vertex *to_vertex = edge->to(graph_);
+          fanin_counts[graph_->id(to_vertex)].fetch_add(1,
+                                                        std::memory_order_relaxed);
+        }
+      }
+      // Levelize bidirect driver as if it was a fanout of the bidirect load.
+      const Pin *pin = vertex->pin();
+      if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
+          && !vertex->isBidirectDriver()) {
+        Vertex *to_vertex = graph_->pinDrvrVertex(pin);
+        fanin_counts[graph_->id(to_vertex)].fetch_add(1,
+                                                      std::memory_order_relaxed);
+      }
     }
+  };
+  if (parallel)
+    dispatch_queue_->parallelFor(vertex_count, thread_count,
+                                 levelize_grain_size_,
+                                 [&](size_t, size_t from, size_t to) {
+                                   countFanin(from, to);
+                                 });
+  else
+    countFanin(0, vertex_count);
+
+  VertexSeq frontier;
+  for (Vertex *vertex : vertices) {
+    VertexId vertex_id = graph_->id(vertex);
+    Level level = keep_levels ? vertex->level() : -1;
+    if (roots_.contains(vertex))
+      level = std::max(level, 0);
+    vertex_levels[vertex_id].store(level, std::memory_order_relaxed);
+    if (fanin_counts[vertex_id].load(std::memory_order_relaxed) == 0)
+      frontier.push_back(vertex);
   }
 
-  std::deque<Vertex *> queue;
-  for (Vertex *root : roots_)
-    queue.push_back(root);
+  // Raise the fanout level before releasing the fanin count so the
+  // thread that visits the fanout sees the final level.
+  auto visitFanout = [&](Vertex *,
+                         Level level,
+                         Vertex *to_vertex,
+                         VertexSeq &next) {
+    VertexId to_id = graph_->id(to_vertex);
+    if (level != -1) {
+      Level to_level = level + level_space;
+      std::atomic<Level> &level_ref = vertex_levels[to_id];
+      Level prev = level_ref.load(std::memory_order_relaxed);
+      while (prev < to_level
+             && !level_ref.compare_exchange_weak(prev, to_level,
+                                                 std::memory_order_relaxed))
+        ;
+    }
+    if (fanin_counts[to_id].fetch_sub(1, std::memory_order_acq_rel) == 1)
+      next.push_back(to_vertex);
+  };
+  auto visitVertices = [&](const VertexSeq &visit,
+                           size_t from,
+                           size_t to,
+                           VertexSeq &next) {
+    for (size_t i = from; i < to; i++) {
+      Vertex *vertex = visit[i];
+      Level level = vertex_levels[graph_->id(vertex)].load(std::memory_order_relaxed);
+      VertexOutEdgeIterator edge_iter(vertex, graph_);
+      while (edge_iter.hasNext()) {
+        Edge *edge = edge_iter.next();
+        if (searchThru(edge))
+          visitFanout(vertex, level, edge->to(graph_), next);
+      }
+      // Levelize bidirect driver as if it was a fanout of the bidirect load.
+      const Pin *pin = vertex->pin();
+      if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
+          && !vertex->isBidirectDriver())
+        visitFanout(vertex, level, graph_->pinDrvrVertex(pin), next);
+    }
+  };
 
+  bool report_order = debug_->check("levelize", 3);
   VertexSeq topo_order;
-  while (!queue.empty()) {
-    Vertex *vertex = queue.front();
-    queue.pop_front();
-    topo_order.push_back(vertex);
-    VertexOutEdgeIterator edge_iter(vertex, graph_);
-    while (edge_iter.hasNext()) {
-      Edge *edge = edge_iter.next();
-      Vertex *to_vertex = edge->to(graph_);
-      if (searchThru(edge)) {
-        const auto &to_degree_itr = in_degree.find(to_vertex);
-        int &to_in_degree = to_degree_itr->second;
-        to_in_degree -= 1;
-        if (to_in_degree == 0)
-          queue.push_back(to_vertex);
+  std::vector<VertexSeq> task_nexts(std::max(thread_count, size_t(1)));
+  size_t visit_count = 0;
+  while (!frontier.empty()) {
+    size_t frontier_size = frontier.size();
+    visit_count += frontier_size;
+    if (report_order)
+      topo_order.insert(topo_order.end(), frontier.begin(), frontier.end());
+    VertexSeq next;
+    if (parallel && frontier_size >= thread_count * levelize_grain_size_) {
+      dispatch_queue_->parallelFor(frontier_size, thread_count,
+                                   levelize_grain_size_,
+                                   [&](size_t task, size_t from, size_t to) {
+                                     visitVertices(frontier, from, to,
+                                                   task_nexts[task]);
+                                   });
+      for (VertexSeq &task_next : task_nexts) {
+        next.insert(next.end(), task_next.begin(), task_next.end());
+        task_next.clear();
       }
     }
-    // Levelize bidirect driver as if it was a fanout of the bidirect load.
-    const Pin *pin = vertex->pin();
-    if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
-        && !vertex->isBidirectDriver()) {
-      Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-      const auto &degree_itr = in_degree.find(to_vertex);
-      int &in_degree = degree_itr->second;
-      in_degree -= 1;
-      if (in_degree == 0)
-        queue.push_back(to_vertex);
-    }
+    else
+      visitVertices(frontier, 0, frontier_size, next);
+    frontier.swap(next);
   }
 
-  if (debug_->check("levelize", 1)) {
-    VertexIterator vertex_iter(graph_);
-    while (vertex_iter.hasNext()) {
-      Vertex *vertex = vertex_iter.next();
-      if (in_degree[vertex] != 0)
+  levels.resize(id_bound);
+  for (Vertex *vertex : vertices) {
+    VertexId vertex_id = graph_->id(vertex);
+    levels[vertex_id] = vertex_levels[vertex_id].load(std::memory_order_relaxed);
+  }
+
+  bool acyclic = visit_count == vertex_count;
+  debugPrint(debug_, "levelize", 1, "topological sort visited {} of {} vertices",
+             visit_count, vertex_count);
+  if (!acyclic && debug_->check("levelize", 2)) {
+    for (Vertex *vertex : vertices) {
+      if (fanin_counts[graph_->id(vertex)].load(std::memory_order_relaxed) != 0)
         debugPrint(debug_, "levelize", 2, "topological sort missing {}",
                    vertex->to_string(this));
     }
   }
-  if (debug_->check("levelize", 3)) {
+  if (report_order) {
     report_->report("Topological sort");
     for (Vertex *vertex : topo_order)
       report_->report("{}", vertex->to_string(this));
   }
   stats.report("Levelize topological sort");
-  return topo_order;
+  return acyclic;
 }
 
 void
@@ -475,35 +562,6 @@ Levelize::reportPath(EdgeSeq &path) const
 
 ////////////////////////////////////////////////////////////////
 
-void
-Levelize::assignLevels(VertexSeq &topo_sorted)
-{
-  for (Vertex *root : roots_)
-    setLevel(root, 0);
-  for (Vertex *vertex : topo_sorted) {
-    if (vertex->level() != -1) {
-      VertexOutEdgeIterator edge_iter(vertex, graph_);
-      while (edge_iter.hasNext()) {
-        Edge *edge = edge_iter.next();
-        Vertex *to_vertex = edge->to(graph_);
-        if (searchThru(edge))
-          setLevel(to_vertex,
-                   std::max(to_vertex->level(), vertex->level() + level_space_));
-      }
-      // Levelize bidirect driver as if it was a fanout of the bidirect load.
-      const Pin *pin = vertex->pin();
-      if (graph_delay_calc_->bidirectDrvrSlewFromLoad(pin)
-          && !vertex->isBidirectDriver()) {
-        Vertex *to_vertex = graph_->pinDrvrVertex(pin);
-        setLevel(to_vertex,
-                 std::max(to_vertex->level(), vertex->level() + level_space_));
-      }
-    }
-  }
-}
-
-////////////////////////////////////////////////////////////////
-
 void
 Levelize::setLevel(Vertex *vertex,
                    Level level)
@@ -571,17 +629,47 @@ Levelize::deleteEdgeBefore(Edge *edge)
 void
 Levelize::relevelize()
 {
+  if (relevelize_from_.size() < relevelize_batch_min_
+      || !relevelizeBatch()) {
+    for (Vertex *vertex : relevelize_from_) {
+      debugPrint(debug_, "levelize", 2, "relevelize from {}",
+                 vertex->to_string(this));
+      if (isRoot(vertex))
+        roots_.insert(vertex);
+      VertexSet path_vertices = makeVertexSet(this);
+      EdgeSeq path;
+      visit(vertex, nullptr, vertex->level(), 1, path_vertices, path);
+    }
+  }
+  levels_valid_ = true;
+  relevelize_from_.clear();
+}
+
+// Relevelize from many vertices with one topological sort instead of
+// a DFS from each vertex. Returns false if the edits added a loop so
+// the DFS can find and break it.
+bool
+Levelize::relevelizeBatch()
+{
+  debugPrint(debug_, "levelize", 1, "relevelize from {} vertices",
+             relevelize_from_.size());
   for (Vertex *vertex : relevelize_from_) {
-    debugPrint(debug_, "levelize", 2, "relevelize from {}",
-               vertex->to_string(this));
     if (isRoot(vertex))
       roots_.insert(vertex);
-    VertexSet path_vertices = makeVertexSet(this);
-    EdgeSeq path;
-    visit(vertex, nullptr, vertex->level(), 1, path_vertices, path);
   }
-  levels_valid_ = true;
-  relevelize_from_.clear();
+  VertexSeq vertices;
+  VertexIterator vertex_iter(graph_);
+  while (vertex_iter.hasNext())
+    vertices.push_back(vertex_iter.next());
+  std::vector<Level> levels;
+  if (!findTopologicalLevels(vertices, 1, true, levels))
+    return false;
+  for (Vertex *vertex : vertices) {
+    Level level = levels[graph_->id(vertex)];
+    if (level != vertex->level())
+      setLevelIncr(vertex, level);
+  }
+  return true;
 }
 
 void
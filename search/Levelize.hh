@@ -77,8 +77,11 @@ public:
 protected:
   void findRoots();
   VertexSeq sortedRootsWithFanout();
-  VertexSeq findTopologicalOrder();
-  void assignLevels(VertexSeq &topo_sorted);
+  bool findTopologicalLevels(const VertexSeq &vertices,
+                             Level level_space,
+                             bool keep_levels,
+                             // Return value.
+                             std::vector<Level> &levels);
   void recordLoop(Edge *edge,
                   EdgeSeq &path);
   EdgeSeq *loopEdges(EdgeSeq &path,
@@ -89,6 +92,7 @@ protected:
   void findCycleBackEdges();
   VertexSeq findUnvisitedVertices();
   void relevelize();
+  bool relevelizeBatch();
   void visit(Vertex *vertex,
              Edge *from,
              Level level,
@@ -114,6 +118,12 @@ protected:
   EdgeSet disabled_loop_edges_;
   LevelizeObserver *observer_{nullptr};
 
+  // Vertices per thread task in the topological sort.
+  static constexpr size_t levelize_grain_size_ = 256;
+  // Relevelize with a topological sort instead of a DFS per vertex
+  // when there are at least this many vertices to relevelize from.
+  static constexpr size_t relevelize_batch_min_ = 1000;
+
   friend class DbGraphReader;
 };
 
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "Clock.hh"
+#include "Debug.hh"
 #include "Delay.hh"
 #include "Format.hh"
 #include "Graph.hh"
@@ -49,63 +50,61 @@
 namespace sta {
 
 Path::Path() :
-  prev_path_(nullptr),
   arrival_(0.0),
   required_(0.0),
   vertex_id_(vertex_id_null),
+  prev_index_(prev_index_null),
   tag_index_(tag_index_null),
   is_enum_(false),
-  prev_arc_idx_(0)
+  prev_arc_idx_(0),
+  is_copy_(false)
 {
 }
 
 Path::Path(const Path *path) :
-  prev_path_(path ? path->prev_path_ : nullptr),
   arrival_(path ? path->arrival_ : delay_zero),
   required_(path ? path->required_ : delay_zero),
   vertex_id_(path ? path->vertex_id_ : vertex_id_null),
+  prev_index_(path ? path->prev_index_ : prev_index_null),
   tag_index_(path ? path->tag_index_ : tag_index_null),
   is_enum_(path ? path->is_enum_ : false),
-  prev_arc_idx_(path ? path->prev_arc_idx_ : 0)
+  prev_arc_idx_(path ? path->prev_arc_idx_ : 0),
+  is_copy_(false)
 {
 }
 
-Path::Path(Vertex *vertex,
-           Tag *tag,
-           const StaState *sta) :
-  prev_path_(nullptr),
-  arrival_(0.0),
-  required_(0.0),
-  tag_index_(tag->index()),
-  is_enum_(false),
-  prev_arc_idx_(0)
+Path::Path(const Path &path) :
+  Path(&path)
 {
-  const Graph *graph = sta->graph();
-  vertex_id_ = graph->id(vertex);
+}
+
+// The target keeps is_copy_ so a Path never casts to PathCopy.
+Path &
+Path::operator=(const Path &path)
+{
+  arrival_ = path.arrival_;
+  required_ = path.required_;
+  vertex_id_ = path.vertex_id_;
+  prev_index_ = path.prev_index_;
+  tag_index_ = path.tag_index_;
+  is_enum_ = path.is_enum_;
+  prev_arc_idx_ = path.prev_arc_idx_;
+  return *this;
 }
 
 Path::Path(Vertex *vertex,
            Tag *tag,
-           const Arrival &arrival,
-           Path *prev_path,
-           Edge *prev_edge,
-           TimingArc *prev_arc,
            const StaState *sta) :
-  prev_path_(prev_path),
-  arrival_(arrival),
+  arrival_(0.0),
   required_(0.0),
+  prev_index_(prev_index_null),
   tag_index_(tag->index()),
-  is_enum_(false)
+  is_enum_(false),
+  prev_arc_idx_(0),
+  is_copy_(false)
 {
   const Graph *graph = sta->graph();
-  if (prev_path) {
-    prev_edge_id_ = graph->id(prev_edge);
-    prev_arc_idx_ = prev_arc->index();
-  }
-  else {
-    vertex_id_ = graph->id(vertex);
-    prev_arc_idx_ = 0;
-  }
+  vertex_id_ = graph->id(vertex);
 }
 
 Path::Path(Vertex *vertex,
@@ -114,22 +113,20 @@ Path::Path(Vertex *vertex,
            Path *prev_path,
            Edge *prev_edge,
            TimingArc *prev_arc,
-           bool is_enum,
            const StaState *sta) :
-  prev_path_(prev_path),
   arrival_(arrival),
   required_(0.0),
+  prev_index_(prev_index_null),
   tag_index_(tag->index()),
-  is_enum_(is_enum)
+  is_enum_(false),
+  prev_arc_idx_(0),
+  is_copy_(false)
 {
   const Graph *graph = sta->graph();
+  vertex_id_ = graph->id(vertex);
   if (prev_path) {
-    prev_edge_id_ = graph->id(prev_edge);
-    prev_arc_idx_ = prev_arc->index();
-  }
-  else {
-    vertex_id_ = graph->id(vertex);
-    prev_arc_idx_ = 0;
+    setPrevPath(prev_path, sta);
+    setPrevEdgeArc(prev_edge, prev_arc, sta);
   }
 }
 
@@ -140,7 +137,8 @@ Path::init(Vertex *vertex,
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
-  tag_index_ = tag_index_null, prev_path_ = nullptr;
+  tag_index_ = tag_index_null;
+  prev_index_ = prev_index_null;
   prev_arc_idx_ = 0;
   arrival_ = arrival;
   required_ = 0.0;
@@ -154,7 +152,8 @@ Path::init(Vertex *vertex,
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
-  tag_index_ = tag->index(), prev_path_ = nullptr;
+  tag_index_ = tag->index();
+  prev_index_ = prev_index_null;
   prev_arc_idx_ = 0;
   arrival_ = 0.0;
   required_ = 0.0;
@@ -169,7 +168,8 @@ Path::init(Vertex *vertex,
 {
   const Graph *graph = sta->graph();
   vertex_id_ = graph->id(vertex);
-  tag_index_ = tag->index(), prev_path_ = nullptr;
+  tag_index_ = tag->index();
+  prev_index_ = prev_index_null;
   prev_arc_idx_ = 0;
   arrival_ = arrival;
   required_ = 0.0;
@@ -185,19 +185,11 @@ Path::init(Vertex *vertex,
            TimingArc *prev_arc,
            const StaState *sta)
 {
-  const Graph *graph = sta->graph();
-  tag_index_ = tag->index(), prev_path_ = prev_path;
+  init(vertex, tag, arrival, sta);
   if (prev_path) {
-    prev_edge_id_ = graph->id(prev_edge);
-    prev_arc_idx_ = prev_arc->index();
+    setPrevPath(prev_path, sta);
+    setPrevEdgeArc(prev_edge, prev_arc, sta);
   }
-  else {
-    vertex_id_ = graph->id(vertex);
-    prev_arc_idx_ = 0;
-  }
-  arrival_ = arrival;
-  required_ = 0.0;
-  is_enum_ = false;
 }
 
 std::string
@@ -224,7 +216,7 @@ Vertex *
 Path::vertex(const StaState *sta) const
 {
   const Graph *graph = sta->graph();
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Edge *edge = graph->edge(prev_edge_id_);
     return edge->to(graph);
   }
@@ -236,7 +228,7 @@ VertexId
 Path::vertexId(const StaState *sta) const
 {
   const Graph *graph = sta->graph();
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Edge *edge = graph->edge(prev_edge_id_);
     return edge->to();
   }
@@ -378,34 +370,64 @@ Path::slack(const StaState *sta) const
 }
 
 Path *
-Path::prevPath() const
+Path::prevPath(const StaState *sta) const
 {
-  return prev_path_;
+  if (prev_index_ == prev_index_null)
+    return nullptr;
+  else if (prev_index_ == prev_index_copy) {
+    if (!is_copy_)
+      sta->report()->critical(1515, "path copied from a PathCopy.");
+    return static_cast<const PathCopy*>(this)->prev_path_;
+  }
+  else {
+    const Graph *graph = sta->graph();
+    const Vertex *prev_vertex = graph->edge(prev_edge_id_)->from(graph);
+    return &prev_vertex->paths()[prev_index_];
+  }
 }
 
 void
-Path::setPrevPath(Path *prev_path)
+Path::setPrevPath(Path *prev_path,
+                  const StaState *sta)
 {
-  prev_path_ = prev_path;
+  if (prev_path == nullptr)
+    prev_index_ = prev_index_null;
+  else if (is_copy_) {
+    static_cast<PathCopy*>(this)->prev_path_ = prev_path;
+    prev_index_ = prev_index_copy;
+  }
+  else {
+    const Vertex *prev_vertex = prev_path->vertex(sta);
+    const Path *prev_paths = prev_vertex->paths();
+    if (sta->debug()->check("path", 1)) {
+      const TagGroup *prev_tag_group = sta->search()->tagGroup(prev_vertex);
+      if (prev_paths == nullptr
+          || prev_tag_group == nullptr
+          || prev_path < prev_paths
+          || prev_path >= prev_paths + prev_tag_group->pathCount())
+        sta->report()->critical(1514, "previous path is not a vertex path.");
+    }
+    prev_index_ = prev_path - prev_paths;
+  }
 }
 
 void
 Path::clearPrevPath(const StaState *sta)
 {
   // Preserve vertex ID for path when prev edge is no longer valid.
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     const Edge *prev_edge = graph->edge(prev_edge_id_);
     vertex_id_ = prev_edge->to();
     prev_arc_idx_ = 0;
   }
-  prev_path_ = nullptr;
+  prev_index_ = prev_index_null;
 }
 
 TimingArc *
 Path::prevArc(const StaState *sta) const
 {
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     const Edge *edge = graph->edge(prev_edge_id_);
     TimingArcSet *arc_set = edge->timingArcSet();
@@ -418,7 +440,7 @@ Path::prevArc(const StaState *sta) const
 Edge *
 Path::prevEdge(const StaState *sta) const
 {
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     return graph->edge(prev_edge_id_);
   }
@@ -429,7 +451,7 @@ Path::prevEdge(const StaState *sta) const
 Vertex *
 Path::prevVertex(const StaState *sta) const
 {
-  if (prev_path_) {
+  if (hasPrevPath()) {
     const Graph *graph = sta->graph();
     return graph->edge(prev_edge_id_)->from(graph);
   }
@@ -454,12 +476,13 @@ Path::setPrevEdgeArc(Edge *prev_edge,
 void
 Path::checkPrevPath(const StaState *sta) const
 {
-  if (prev_path_ && prev_path_->isNull())
+  const Path *prev_path = prevPath(sta);
+  if (prev_path && prev_path->isNull())
     sta->report()->report("path {} prev path is null.", to_string(sta));
-  if (prev_path_ && !prev_path_->isNull()) {
+  if (prev_path && !prev_path->isNull()) {
     Graph *graph = sta->graph();
     Edge *edge = prevEdge(sta);
-    Vertex *prev_vertex = prev_path_->vertex(sta);
+    Vertex *prev_vertex = prev_path->vertex(sta);
     Vertex *prev_edge_vertex = edge->from(graph);
     if (prev_vertex != prev_edge_vertex) {
       Network *network = sta->network();
@@ -606,6 +629,63 @@ Path::equal(const Path *path1,
 
 ////////////////////////////////////////////////////////////////
 
+PathCopy::PathCopy() :
+  prev_path_(nullptr)
+{
+  is_copy_ = true;
+}
+
+PathCopy::PathCopy(const Path *path,
+                   const StaState *sta) :
+  prev_path_(nullptr)
+{
+  is_copy_ = true;
+  if (path) {
+    arrival_ = path->arrival();
+    required_ = path->required();
+    vertex_id_ = path->vertexId(sta);
+    tag_index_ = path->tagIndex(sta);
+    is_enum_ = path->isEnum();
+    Path *prev_path = path->prevPath(sta);
+    if (prev_path) {
+      setPrevPath(prev_path, sta);
+      setPrevEdgeArc(path->prevEdge(sta), path->prevArc(sta), sta);
+    }
+  }
+}
+
+PathCopy::PathCopy(Vertex *vertex,
+                   Tag *tag,
+                   const Arrival &arrival,
+                   Path *prev_path,
+                   Edge *prev_edge,
+                   TimingArc *prev_arc,
+                   bool is_enum,
+                   const StaState *sta) :
+  prev_path_(nullptr)
+{
+  is_copy_ = true;
+  init(vertex, tag, arrival, prev_path, prev_edge, prev_arc, sta);
+  is_enum_ = is_enum;
+}
+
+PathCopy::PathCopy(const PathCopy &path) :
+  Path(static_cast<const Path*>(&path)),
+  prev_path_(path.prev_path_)
+{
+  is_copy_ = true;
+}
+
+PathCopy &
+PathCopy::operator=(const PathCopy &path)
+{
+  Path::operator=(static_cast<const Path&>(path));
+  prev_path_ = path.prev_path_;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////
+
 PathLess::PathLess(const StaState *sta) :
   sta_(sta)
 {
@@ -686,8 +766,8 @@ Path::cmpAll(const Path *path1,
 
     TimingArc *prev_arc1 = p1->prevArc(sta);
     TimingArc *prev_arc2 = p2->prevArc(sta);
-    p1 = p1->prevPath();
-    p2 = p2->prevPath();
+    p1 = p1->prevPath(sta);
+    p2 = p2->prevPath(sta);
     if (equal(p1, path1, sta))
       // Equivalent latch loops.
       return 0;
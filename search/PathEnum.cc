@@ -24,12 +24,15 @@
 
 #include "PathEnum.hh"
 
+#include <algorithm>
 #include <cstddef>
 #include <map>
 #include <set>
 #include <utility>
 
+#include "ContainerHelpers.hh"
 #include "Debug.hh"
+#include "DispatchQueue.hh"
 #include "Delay.hh"
 #include "Error.hh"
 #include "Graph.hh"
@@ -229,7 +232,7 @@ PathEnum::reportDiversionPath(Diversion *div)
                     Path::equal(p, after_div, this) ? " <-after diversion" : "");
     if (p != path && network_->isLatchData(p->pin(this)))
       break;
-    p = p->prevPath();
+    p = p->prevPath(this);
   }
 }
 
@@ -555,7 +558,7 @@ PathEnumFaninVisitor::reportDiversion(const Edge *div_edge,
                                                        after_div, div_edge,
                                                        div_arc),
                                   this);
-    Path *div_prev = before_div_->prevPath();
+    Path *div_prev = before_div_->prevPath(this);
     report_->report("path_enum: diversion {} {} {} -> {}", path->to_string(this),
                     path_enum_->cmp_slack_ ? "slack" : "delay",
                     delayAsString(path_delay, this), delayAsString(div_delay, this));
@@ -643,7 +646,7 @@ PathEnum::makeDiversions(PathEnd *path_end,
                          Path *before)
 {
   Path *path = before;
-  Path *prev_path = path->prevPath();
+  Path *prev_path = path->prevPath(this);
   TimingArc *prev_arc = path->prevArc(this);
   PathEnumFaninVisitor fanin_visitor(path_end, path, unique_pins_, unique_edges_,
                                      this);
@@ -658,7 +661,7 @@ PathEnum::makeDiversions(PathEnd *path_end,
     if (prev_role == TimingRole::latchDtoQ() || prev_role == TimingRole::regClkToQ())
       break;
     path = prev_path;
-    prev_path = path->prevPath();
+    prev_path = path->prevPath(this);
     prev_arc = path->prevArc(this);
   }
 }
@@ -683,13 +686,13 @@ PathEnum::makeDivertedPath(Path *path,
   Path *prev_copy = nullptr;
   while (p) {
     // prev_path made in next pass.
-    Path *copy = new Path(p->vertex(this), p->tag(this), p->arrival(),
-                          // Replaced on next pass.
-                          p->prevPath(), p->prevEdge(this), p->prevArc(this),
-                          true, this);
+    PathCopy *copy = new PathCopy(p->vertex(this), p->tag(this), p->arrival(),
+                                  // Replaced on next pass.
+                                  p->prevPath(this), p->prevEdge(this),
+                                  p->prevArc(this), true, this);
     search_->saveEnumPath(copy);
     if (prev_copy)
-      prev_copy->setPrevPath(copy);
+      prev_copy->setPrevPath(copy, this);
     copies.push_back(copy);
 
     if (p == after_div)
@@ -700,7 +703,7 @@ PathEnum::makeDivertedPath(Path *path,
       break;
     if (p == before_div) {
       // Replaced on next pass.
-      copy->setPrevPath(after_div);
+      copy->setPrevPath(after_div, this);
       copy->setPrevEdgeArc(div_edge, div_arc, this);
       // Update the delays forward from before_div to the end of the path.
       updatePathHeadDelays(copies, after_div);
@@ -708,7 +711,7 @@ PathEnum::makeDivertedPath(Path *path,
       found_div = true;
     }
     else
-      p = p->prevPath();
+      p = p->prevPath(this);
 
     prev_copy = copy;
     first = false;
@@ -775,4 +778,162 @@ PathEnum::updatePathHeadDelays(PathSeq &paths,
   }
 }
 
+////////////////////////////////////////////////////////////////
+
+PathEnumEndpoint::PathEnumEndpoint(PathEnum *path_enum,
+                                   size_t path_count) :
+  path_enum(path_enum),
+  path_count(path_count)
+{
+}
+
+PathEnumEndpoint::~PathEnumEndpoint()
+{
+  delete path_enum;
+  deleteContents(ends);
+}
+
+////////////////////////////////////////////////////////////////
+
+PathEnumParallel::PathEnumParallel(size_t group_path_count,
+                                   size_t endpoint_path_count,
+                                   bool unique_edges,
+                                   bool cmp_slack,
+                                   const StaState *sta) :
+  StaState(sta),
+  group_path_count_(group_path_count),
+  endpoint_path_count_(endpoint_path_count),
+  unique_edges_(unique_edges),
+  cmp_slack_(cmp_slack)
+{
+}
+
+PathEnumParallel::~PathEnumParallel()
+{
+  deleteContents(endpoints_);
+}
+
+void
+PathEnumParallel::insert(PathEnd *path_end)
+{
+  Vertex *vertex = path_end->vertex(this);
+  PathEnumEndpoint *endpoint;
+  auto itr = endpoint_index_map_.find(vertex);
+  if (itr == endpoint_index_map_.end()) {
+    // An endpoint never returns more than the group path count.
+    size_t path_count = std::min(endpoint_path_count_, group_path_count_);
+    PathEnum *path_enum = new PathEnum(path_count, endpoint_path_count_,
+                                       false, unique_edges_, cmp_slack_, this);
+    endpoint = new PathEnumEndpoint(path_enum, path_count);
+    endpoint_index_map_[vertex] = endpoints_.size();
+    endpoints_.push_back(endpoint);
+  }
+  else
+    endpoint = endpoints_[itr->second];
+  endpoint->path_enum->insert(path_end);
+}
+
+// Heads are ordered like the PathEnum diversion queue so the merge
+// returns paths in the same order. Ties go to the first endpoint
+// inserted so the merge is deterministic.
+bool
+PathEnumParallel::headLess(size_t index1,
+                           size_t index2) const
+{
+  const PathEnd *end1 = endpoints_[index1]->ends.front();
+  const PathEnd *end2 = endpoints_[index2]->ends.front();
+  int cmp = PathEnd::cmp(end1, end2, true, this);
+  if (cmp == 0)
+    return index1 < index2;
+  else
+    return cmp < 0;
+}
+
+bool
+PathEnumParallel::hasNext()
+{
+  if (!started_) {
+    started_ = true;
+    refill(endpoints_);
+    for (size_t i = 0; i < endpoints_.size(); i++) {
+      if (!endpoints_[i]->ends.empty())
+        heads_.push_back(i);
+    }
+    std::make_heap(heads_.begin(), heads_.end(),
+                   [this](size_t index1, size_t index2) {
+                     return headLess(index2, index1);
+                   });
+  }
+  return !heads_.empty();
+}
+
+PathEnd *
+PathEnumParallel::next()
+{
+  auto head_greater = [this](size_t index1,
+                             size_t index2) {
+    return headLess(index2, index1);
+  };
+  std::pop_heap(heads_.begin(), heads_.end(), head_greater);
+  size_t index = heads_.back();
+  heads_.pop_back();
+  PathEnumEndpoint *endpoint = endpoints_[index];
+  PathEnd *path_end = endpoint->ends.front();
+  endpoint->ends.pop_front();
+  if (endpoint->ends.empty() && !endpoint->done) {
+    // The merge cannot continue until the endpoint finds its next path.
+    // Endpoints that are used up quickly get larger chunks.
+    endpoint->chunk_size *= 2;
+    PathEnumEndpointSeq refills;
+    refills.push_back(endpoint);
+    // Refill the endpoints that are running low at the same time.
+    for (size_t head_index : heads_) {
+      PathEnumEndpoint *endpoint1 = endpoints_[head_index];
+      if (!endpoint1->done
+          && endpoint1->ends.size() * 2 < endpoint1->chunk_size)
+        refills.push_back(endpoint1);
+    }
+    refill(refills);
+  }
+  if (!endpoint->ends.empty()) {
+    heads_.push_back(index);
+    std::push_heap(heads_.begin(), heads_.end(), head_greater);
+  }
+  return path_end;
+}
+
+void
+PathEnumParallel::refill(const PathEnumEndpointSeq &endpoints)
+{
+  size_t endpoint_count = endpoints.size();
+  if (thread_count_ > 1 && endpoint_count > 1)
+    dispatch_queue_->parallelFor(endpoint_count, thread_count_, 1,
+                                 [&](size_t, size_t from, size_t to) {
+                                   for (size_t i = from; i < to; i++)
+                                     refill(endpoints[i]);
+                                 });
+  else {
+    for (PathEnumEndpoint *endpoint : endpoints)
+      refill(endpoint);
+  }
+}
+
+void
+PathEnumParallel::refill(PathEnumEndpoint *endpoint)
+{
+  size_t count = std::min(endpoint->chunk_size, endpoint->path_count);
+  for (size_t i = 0; i < count; i++) {
+    if (endpoint->path_enum->hasNext()) {
+      endpoint->ends.push_back(endpoint->path_enum->next());
+      endpoint->path_count--;
+    }
+    else {
+      endpoint->done = true;
+      break;
+    }
+  }
+  if (endpoint->path_count == 0)
+    endpoint->done = true;
+}
+
 }  // namespace sta
@@ -25,6 +25,8 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
+#include <map>
 #include <queue>
 #include <vector>
 
@@ -110,4 +112,61 @@ private:
   friend class PathEnumFaninVisitor;
 };
 
+// Path enumeration for one endpoint of PathEnumParallel.
+class PathEnumEndpoint
+{
+public:
+  PathEnumEndpoint(PathEnum *path_enum,
+                   size_t path_count);
+  ~PathEnumEndpoint();
+
+  PathEnum *path_enum;
+  // Enumerated path ends that have not been merged.
+  std::deque<PathEnd*> ends;
+  // Path ends to enumerate on the next refill.
+  size_t chunk_size{1};
+  // Path ends left to enumerate.
+  size_t path_count;
+  bool done{false};
+};
+
+using PathEnumEndpointSeq = std::vector<PathEnumEndpoint*>;
+
+// Enumerate the paths to each endpoint with its own PathEnum in
+// parallel and merge them in the order a single PathEnum over all of
+// the endpoints returns them. Diversions never change the endpoint of
+// a path, so the paths to an endpoint are found in the same order by
+// either one, and the queue pruning only removes diversions that
+// would not be returned. That does not hold for unique_pins, which
+// prunes to one diversion per endpoint, so it uses PathEnum.
+class PathEnumParallel : public Iterator<PathEnd*>, StaState
+{
+public:
+  PathEnumParallel(size_t group_path_count,
+                   size_t endpoint_path_count,
+                   bool unique_edges,
+                   bool cmp_slack,
+                   const StaState *sta);
+  ~PathEnumParallel() override;
+  void insert(PathEnd *path_end);
+  bool hasNext() override;
+  PathEnd *next() override;
+
+private:
+  void refill(const PathEnumEndpointSeq &endpoints);
+  void refill(PathEnumEndpoint *endpoint);
+  bool headLess(size_t index1,
+                size_t index2) const;
+
+  size_t group_path_count_;
+  size_t endpoint_path_count_;
+  bool unique_edges_;
+  bool cmp_slack_;
+  PathEnumEndpointSeq endpoints_;
+  std::map<Vertex*, size_t> endpoint_index_map_;
+  // Heap of endpoint indices ordered by the first enumerated path end.
+  std::vector<size_t> heads_;
+  bool started_{false};
+};
+
 } // namespace sta
@@ -114,11 +114,20 @@ PathGroup::~PathGroup()
 bool
 PathGroup::saveable(PathEnd *path_end)
 {
-  float threshold;
-  {
-    LockGuard lock(lock_);
-    threshold = threshold_;
-  }
+  return saveable(path_end, threshold());
+}
+
+float
+PathGroup::threshold()
+{
+  LockGuard lock(lock_);
+  return threshold_;
+}
+
+bool
+PathGroup::saveable(PathEnd *path_end,
+                    float threshold) const
+{
   if (cmp_slack_) {
     // Crpr increases the slack, so check the slack
     // without crpr first because it is expensive to find.
@@ -185,33 +194,52 @@ PathGroup::insert(PathEnd *path_end)
     prune();
 }
 
+void
+PathGroup::insert(PathEndSeq &path_ends)
+{
+  LockGuard lock(lock_);
+  for (PathEnd *path_end : path_ends) {
+    path_ends_.push_back(path_end);
+    path_end->setPathGroup(this);
+  }
+  if (group_path_count_ != group_path_count_max
+      && path_ends_.size() > group_path_count_ * 2)
+    prune();
+}
+
 void
 PathGroup::prune()
 {
-  sort();
+  threshold_ = pruneEnds(path_ends_);
+}
+
+float
+PathGroup::pruneEnds(PathEndSeq &path_ends) const
+{
+  sta::sort(path_ends, PathEndLess(cmp_slack_, sta_));
   VertexPathCountMap path_counts;
   size_t end_count = 0;
-  for (PathEnd *path_end : path_ends_) {
+  for (PathEnd *path_end : path_ends) {
     Vertex *vertex = path_end->vertex(sta_);
     // Squish up to endpoint_path_count path ends per vertex
-    // up to the front of path_ends_.
+    // up to the front of path_ends.
     if (end_count < group_path_count_
         && path_counts[vertex] < endpoint_path_count_) {
-      path_ends_[end_count++] = path_end;
+      path_ends[end_count++] = path_end;
       path_counts[vertex]++;
     }
     else
       delete path_end;
   }
-  path_ends_.resize(end_count);
+  path_ends.resize(end_count);
 
   // Set a threshold to the bottom of the sorted list that future
   // inserts need to beat.
-  PathEnd *last_end = path_ends_[end_count - 1];
+  PathEnd *last_end = path_ends[end_count - 1];
   if (cmp_slack_)
-    threshold_ = delayAsFloat(last_end->slack(sta_));
+    return delayAsFloat(last_end->slack(sta_));
   else
-    threshold_ = delayAsFloat(last_end->dataArrivalTime(sta_));
+    return delayAsFloat(last_end->dataArrivalTime(sta_));
 }
 
 void
@@ -247,6 +275,44 @@ PathGroup::clear()
 
 ////////////////////////////////////////////////////////////////
 
+PathGroupEnds::PathGroupEnds(PathGroup *group) :
+  group_(group),
+  threshold_(group->threshold())
+{
+}
+
+PathGroupEnds::~PathGroupEnds()
+{
+  deleteContents(path_ends_);
+}
+
+bool
+PathGroupEnds::saveable(PathEnd *path_end) const
+{
+  return group_->saveable(path_end, threshold_);
+}
+
+void
+PathGroupEnds::insert(PathEnd *path_end)
+{
+  path_ends_.push_back(path_end);
+  size_t group_path_count = group_->maxPaths();
+  if (group_path_count != PathGroup::group_path_count_max
+      && path_ends_.size() > group_path_count * 2)
+    threshold_ = group_->pruneEnds(path_ends_);
+}
+
+size_t
+PathGroupEnds::merge()
+{
+  size_t merge_count = path_ends_.size();
+  group_->insert(path_ends_);
+  path_ends_.clear();
+  return merge_count;
+}
+
+////////////////////////////////////////////////////////////////
+
 PathGroups::PathGroups(size_t group_path_count,
                        size_t endpoint_path_count,
                        bool unique_pins,
@@ -638,9 +704,66 @@ PathGroups::makePathEnds(ExceptionTo *to,
 
 ////////////////////////////////////////////////////////////////
 
+// Path end visitor that collects the path ends for each path group
+// in PathGroupEnds so threads do not contend for the group locks.
+// Each thread visits with its own copy.
+class MakePathEnds : public PathEndVisitor
+{
+public:
+  MakePathEnds(PathGroups *path_groups);
+  MakePathEnds(const MakePathEnds &make_path_ends);
+  ~MakePathEnds() override;
+  // Insert the collected path ends into the path groups.
+  // Returns the number of path ends merged.
+  size_t mergeGroupEnds();
+
+protected:
+  PathGroupEnds *groupEnds(PathGroup *group);
+
+  PathGroups *path_groups_;
+  std::map<PathGroup*, PathGroupEnds*> group_ends_;
+};
+
+MakePathEnds::MakePathEnds(PathGroups *path_groups) :
+  path_groups_(path_groups)
+{
+}
+
+MakePathEnds::MakePathEnds(const MakePathEnds &make_path_ends) :
+  path_groups_(make_path_ends.path_groups_)
+{
+}
+
+MakePathEnds::~MakePathEnds()
+{
+  deleteContents(group_ends_);
+}
+
+PathGroupEnds *
+MakePathEnds::groupEnds(PathGroup *group)
+{
+  PathGroupEnds *group_ends = findKey(group_ends_, group);
+  if (group_ends == nullptr) {
+    group_ends = new PathGroupEnds(group);
+    group_ends_[group] = group_ends;
+  }
+  return group_ends;
+}
+
+size_t
+MakePathEnds::mergeGroupEnds()
+{
+  size_t merge_count = 0;
+  for (auto [group, group_ends] : group_ends_)
+    merge_count += group_ends->merge();
+  return merge_count;
+}
+
+////////////////////////////////////////////////////////////////
+
 // Visit each path end for a vertex and add the worst one in each
 // path group to the group.
-class MakePathEnds1 : public PathEndVisitor
+class MakePathEnds1 : public MakePathEnds
 {
 public:
   MakePathEnds1(PathGroups *path_groups);
@@ -653,13 +776,12 @@ private:
   void visitPathEnd(PathEnd *path_end,
                     PathGroup *group);
 
-  PathGroups *path_groups_;
   PathGroupEndMap ends_;
   PathEndLess less_;
 };
 
 MakePathEnds1::MakePathEnds1(PathGroups *path_groups) :
-  path_groups_(path_groups),
+  MakePathEnds(path_groups),
   less_(true, path_groups)
 {
 }
@@ -681,7 +803,7 @@ void
 MakePathEnds1::visitPathEnd(PathEnd *path_end,
                             PathGroup *group)
 {
-  if (group->saveable(path_end)) {
+  if (groupEnds(group)->saveable(path_end)) {
     // Only keep the path end with the smallest slack/latest arrival.
     PathEnd *worst_end = findKey(ends_, group);
     if (worst_end) {
@@ -702,7 +824,7 @@ MakePathEnds1::vertexEnd(Vertex *)
   for (auto [group, end] : ends_) {
     // visitPathEnd already confirmed slack is saveable.
     if (end) {
-      group->insert(end);
+      groupEnds(group)->insert(end);
       // Clear ends_ for next vertex.
       ends_[group] = nullptr;
     }
@@ -714,7 +836,7 @@ MakePathEnds1::vertexEnd(Vertex *)
 // Visit each path end and add it to the corresponding path group.
 // After collecting the ends do parallel path enumeration to find the
 // path ends for the group.
-class MakePathEndsAll : public PathEndVisitor
+class MakePathEndsAll : public MakePathEnds
 {
 public:
   MakePathEndsAll(size_t endpoint_path_count,
@@ -730,7 +852,6 @@ private:
                     PathGroup *group);
 
   size_t endpoint_path_count_;
-  PathGroups *path_groups_;
   const StaState *sta_;
   PathGroupEndsMap ends_;
   PathEndSlackLess less_;
@@ -739,8 +860,8 @@ private:
 
 MakePathEndsAll::MakePathEndsAll(size_t endpoint_path_count,
                                  PathGroups *path_groups) :
+  MakePathEnds(path_groups),
   endpoint_path_count_(endpoint_path_count),
-  path_groups_(path_groups),
   sta_(path_groups),
   less_(true, path_groups),
   path_no_crpr_less_(path_groups)
@@ -801,9 +922,10 @@ MakePathEndsAll::vertexEnd(Vertex *)
                      path_end->path()->tag(sta_)->index());
           // Give the group a copy of the path end because
           // it may delete it during pruning.
-          if (group->saveable(path_end)
+          PathGroupEnds *group_ends = groupEnds(group);
+          if (group_ends->saveable(path_end)
               || group->enumMinSlackUnderMin(path_end)) {
-            group->insert(path_end->copy());
+            group_ends->insert(path_end->copy());
             unique_ends.insert(path_end);
             n++;
           }
@@ -878,18 +1000,14 @@ PathGroups::makeGroupPathEnds(ExceptionTo *to,
   }
 }
 
-void
-PathGroups::enumPathEnds(PathGroup *group,
-                         size_t group_path_count,
-                         size_t endpoint_path_count,
-                         bool unique_pins,
-                         bool unique_edges,
-                         bool cmp_slack)
+// Insert the worst max_path path ends in the group into a path
+// enumerator and replace them with the enumerated path ends.
+template <class PATH_ENUM>
+static void
+enumGroupPathEnds(PathGroup *group,
+                  size_t group_path_count,
+                  PATH_ENUM &path_enum)
 {
-  // Insert the worst max_path path ends in the group into a path
-  // enumerator.
-  PathEnum path_enum(group_path_count, endpoint_path_count,
-                     unique_pins, unique_edges, cmp_slack, this);
   for (PathEnd *end : group->pathEnds()) {
     if (group->saveable(end)
         || group->enumMinSlackUnderMin(end))
@@ -897,7 +1015,6 @@ PathGroups::enumPathEnds(PathGroup *group,
   }
   group->clear();
 
-  // Parallel path enumeratation to find the endpoint_path_count/max path ends.
   for (size_t n = 0; path_enum.hasNext() && n < group_path_count; n++) {
     PathEnd *end = path_enum.next();
     if (group->saveable(end))
@@ -907,11 +1024,32 @@ PathGroups::enumPathEnds(PathGroup *group,
   }
 }
 
+void
+PathGroups::enumPathEnds(PathGroup *group,
+                         size_t group_path_count,
+                         size_t endpoint_path_count,
+                         bool unique_pins,
+                         bool unique_edges,
+                         bool cmp_slack)
+{
+  if (thread_count_ > 1 && !unique_pins) {
+    // Enumerate the paths to each endpoint in parallel.
+    PathEnumParallel path_enum(group_path_count, endpoint_path_count,
+                               unique_edges, cmp_slack, this);
+    enumGroupPathEnds(group, group_path_count, path_enum);
+  }
+  else {
+    PathEnum path_enum(group_path_count, endpoint_path_count,
+                       unique_pins, unique_edges, cmp_slack, this);
+    enumGroupPathEnds(group, group_path_count, path_enum);
+  }
+}
+
 void
 PathGroups::makeGroupPathEnds(ExceptionTo *to,
                               const SceneSeq &scenes,
                               const MinMaxAll *min_max,
-                              PathEndVisitor *visitor)
+                              MakePathEnds *visitor)
 {
   if (exceptionToEmpty(to))
     makeGroupPathEnds(search_->endpoints(), scenes, min_max, visitor);
@@ -947,7 +1085,7 @@ exceptionToEmpty(ExceptionTo *to)
 class MakeEndpointPathEnds : public VertexVisitor
 {
 public:
-  MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
+  MakeEndpointPathEnds(MakePathEnds *path_end_visitor,
                        const SceneSet &scenes,
                        const MinMaxAll *min_max,
                        const StaState *sta);
@@ -955,21 +1093,22 @@ public:
   ~MakeEndpointPathEnds() override;
   VertexVisitor *copy() const override;
   void visit(Vertex *vertex) override;
+  size_t mergeGroupEnds() { return path_end_visitor_->mergeGroupEnds(); }
 
 private:
   VisitPathEnds visit_path_ends_;
-  PathEndVisitor *path_end_visitor_;
+  MakePathEnds *path_end_visitor_;
   const SceneSet scenes_;
   const MinMaxAll *min_max_;
   const StaState *sta_;
 };
 
-MakeEndpointPathEnds::MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
+MakeEndpointPathEnds::MakeEndpointPathEnds(MakePathEnds *path_end_visitor,
                                            const SceneSet &scenes,
                                            const MinMaxAll *min_max,
                                            const StaState *sta) :
   visit_path_ends_(sta),
-  path_end_visitor_(path_end_visitor->copy()),
+  path_end_visitor_(static_cast<MakePathEnds*>(path_end_visitor->copy())),
   scenes_(scenes),
   min_max_(min_max),
   sta_(sta)
@@ -978,7 +1117,7 @@ MakeEndpointPathEnds::MakeEndpointPathEnds(PathEndVisitor *path_end_visitor,
 
 MakeEndpointPathEnds::MakeEndpointPathEnds(const MakeEndpointPathEnds &make_path_ends) :
   visit_path_ends_(make_path_ends.sta_),
-  path_end_visitor_(make_path_ends.path_end_visitor_->copy()),
+  path_end_visitor_(static_cast<MakePathEnds*>(make_path_ends.path_end_visitor_->copy())),
   scenes_(make_path_ends.scenes_),
   min_max_(make_path_ends.min_max_),
   sta_(make_path_ends.sta_)
@@ -1009,24 +1148,36 @@ void
 PathGroups::makeGroupPathEnds(VertexSet &endpoints,
                               const SceneSeq &scenes,
                               const MinMaxAll *min_max,
-                              PathEndVisitor *visitor)
+                              MakePathEnds *visitor)
 {
   if (thread_count_ == 1) {
     MakeEndpointPathEnds end_visitor(visitor, Scene::sceneSet(scenes),
                                      min_max, this);
     for (Vertex *endpoint : endpoints)
       end_visitor.visit(endpoint);
+    end_visitor.mergeGroupEnds();
   }
   else {
     std::vector<MakeEndpointPathEnds>
       visitors(thread_count_,
                MakeEndpointPathEnds(visitor, Scene::sceneSet(scenes),
                                     min_max, this));
-    for (const auto endpoint : endpoints) {
-      dispatch_queue_->dispatch( [endpoint, &visitors](size_t i)
-      { visitors[i].visit(endpoint); } );
-    }
-    dispatch_queue_->finishTasks();
+    // Dispatch the endpoints in chunks rather than one task per endpoint.
+    VertexSeq endpoint_seq(endpoints.begin(), endpoints.end());
+    dispatch_queue_->parallelFor(endpoint_seq.size(), thread_count_,
+                                 endpoint_grain_size_,
+                                 [&](size_t task, size_t from, size_t to) {
+                                   for (size_t i = from; i < to; i++)
+                                     visitors[task].visit(endpoint_seq[i]);
+                                 });
+
+    Stats stats(debug_, report_);
+    size_t merge_count = 0;
+    for (MakeEndpointPathEnds &end_visitor : visitors)
+      merge_count += end_visitor.mergeGroupEnds();
+    debugPrint(debug_, "path_group", 1, "merged {} thread path ends",
+               merge_count);
+    stats.report("Merge path group ends");
   }
 }
 
@@ -0,0 +1,92 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "PathPool.hh"
+
+#include "Mutex.hh"
+#include "Report.hh"
+
+namespace sta {
+
+PathPoolShard &
+PathPool::shard(VertexId vertex_id)
+{
+  return shards_[vertex_id % shard_count];
+}
+
+Path *
+PathPool::make(VertexId vertex_id,
+               size_t count)
+{
+  PathPoolShard &pool_shard = shard(vertex_id);
+  LockGuard lock(pool_shard.lock);
+  return pool_shard.arena.make(count);
+}
+
+void
+PathPool::destroy(VertexId vertex_id,
+                  Path *paths,
+                  size_t count)
+{
+  PathPoolShard &pool_shard = shard(vertex_id);
+  LockGuard lock(pool_shard.lock);
+  pool_shard.arena.destroy(paths, count);
+}
+
+void
+PathPool::clear()
+{
+  for (PathPoolShard &pool_shard : shards_) {
+    LockGuard lock(pool_shard.lock);
+    pool_shard.arena.clear();
+  }
+}
+
+void
+PathPool::reportMemory(Report *report) const
+{
+  size_t block_count = 0;
+  size_t capacity = 0;
+  size_t size = 0;
+  size_t free_count = 0;
+  for (PathPoolShard &pool_shard : shards_) {
+    LockGuard lock(pool_shard.lock);
+    block_count += pool_shard.arena.blockCount();
+    capacity += pool_shard.arena.capacity();
+    size += pool_shard.arena.size();
+    free_count += pool_shard.arena.freeCount();
+  }
+  constexpr double mbyte = 1024.0 * 1024.0;
+  double occupancy = capacity ? size * 100.0 / capacity : 0.0;
+  report->report("Path arrays");
+  report->report(" blocks   {:10}", block_count);
+  report->report(" capacity {:10} paths {:8.1f}MB", capacity,
+                 capacity * sizeof(Path) / mbyte);
+  report->report(" used     {:10} paths {:8.1f}MB {:5.1f}%", size,
+                 size * sizeof(Path) / mbyte, occupancy);
+  report->report(" free     {:10} paths {:8.1f}MB", free_count,
+                 free_count * sizeof(Path) / mbyte);
+}
+
+} // namespace sta
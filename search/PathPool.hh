@@ -0,0 +1,71 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include "ArrayArena.hh"
+#include "GraphClass.hh"
+#include "Path.hh"
+
+namespace sta {
+
+class Report;
+
+// Aligned so shard locks do not share cache lines.
+class alignas(64) PathPoolShard
+{
+public:
+  std::mutex lock;
+  ArrayArena<Path, 1024> arena;
+};
+
+// Allocator for the vertex path arrays made by the arrival search.
+// Arrays come from per-size free lists and large blocks instead of
+// the heap. The arenas are sharded by vertex ID so that threads
+// visiting different vertices rarely wait on the same lock. An array
+// must be destroyed with the vertex ID it was made with.
+class PathPool
+{
+public:
+  Path *make(VertexId vertex_id,
+             size_t count);
+  void destroy(VertexId vertex_id,
+               Path *paths,
+               size_t count);
+  // Free all path arrays.
+  void clear();
+  void reportMemory(Report *report) const;
+
+  static constexpr size_t shard_count = 64;
+
+private:
+  PathPoolShard &shard(VertexId vertex_id);
+
+  mutable std::array<PathPoolShard, shard_count> shards_;
+};
+
+} // namespace sta
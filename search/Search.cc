@@ -25,6 +25,7 @@
 #include "Search.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <vector>
 
@@ -55,6 +56,7 @@
 #include "Path.hh"
 #include "PathEnd.hh"
 #include "PathGroup.hh"
+#include "PathPool.hh"
 #include "PortDelay.hh"
 #include "PortDirection.hh"
 #include "Report.hh"
@@ -252,20 +254,24 @@ Search::Search(StaState *sta) :
                                    nullptr,
                                    this)),
   arrival_visitor_(new ArrivalVisitor(this)),
+  path_pool_(new PathPool),
 
   invalid_requireds_(makeVertexSet(this)),
   required_iter_(new BfsBkwdIterator(BfsIndex::required, search_adj_, this)),
 
   invalid_tns_(makeVertexSet(this)),
-  clk_info_set_(new ClkInfoSet(ClkInfoLess(this))),
-
-  tags_(new Tag *[tag_capacity_]),
-  tag_set_(new TagSet(tag_capacity_,
-                      TagHash(this),
-                      TagEqual(this))),
-  tag_group_capacity_(tag_capacity_),
-  tag_groups_(new TagGroup *[tag_group_capacity_]),
-  tag_group_set_(new TagGroupSet(tag_group_capacity_)),
+  clk_info_set_(new ClkInfoSet(tag_capacity_init_,
+                                ClkInfoHash(),
+                                ClkInfoEqual(this))),
+
+  tags_(tag_index_max),
+  tag_set_(new TagInternSet(tag_capacity_init_,
+                            TagHash(this),
+                            TagEqual(this))),
+  tag_groups_(tag_group_index_max),
+  tag_group_set_(new TagGroupSet(tag_capacity_init_,
+                                 TagGroupHash(),
+                                 TagGroupEqual())),
   pending_arrivals_(makeVertexSet(this)),
   endpoints_(makeVertexSet(this)),
   invalid_endpoints_(makeVertexSet(this)),
@@ -292,11 +298,10 @@ Search::~Search()
 {
   deletePathGroups();
   deletePaths();
+  delete path_pool_;
   deleteTags();
   delete tag_set_;
   delete clk_info_set_;
-  delete[] tags_;
-  delete[] tag_groups_;
   delete tag_group_set_;
   delete search_thru_;
   delete search_adj_;
@@ -319,7 +324,6 @@ Search::clear()
   arrivals_seeded_ = false;
   requireds_exist_ = false;
   requireds_seeded_ = false;
-  tns_exists_ = false;
   clearWorstSlack();
   invalid_arrivals_.clear();
   arrival_iter_->clear();
@@ -374,14 +378,15 @@ Search::deleteTags()
     delete group;
   }
   tag_group_next_ = 0;
+  tag_groups_.clear();
   tag_group_set_->clear();
   tag_group_free_indices_.clear();
 
   tag_next_ = 0;
-  deleteContents(tag_set_);
+  tags_.clear();
+  tag_set_->deleteContents();
 
-  deleteContents(clk_info_set_);
-  deleteTagsPrev();
+  clk_info_set_->deleteContents();
 }
 
 void
@@ -428,11 +433,15 @@ Search::deletePaths()
 {
   debugPrint(debug_, "search", 1, "delete paths");
   if (arrivals_exist_) {
+    // The path arrays are freed all at once by clearing the pool and
+    // the tag groups are deleted by the caller, so only the vertex
+    // references are reset.
     VertexIterator vertex_iter(graph_);
     while (vertex_iter.hasNext()) {
       Vertex *vertex = vertex_iter.next();
-      deletePaths(vertex);
+      vertex->deletePaths();
     }
+    path_pool_->clear();
 
     deleteContents(enum_paths_);
 
@@ -442,8 +451,9 @@ Search::deletePaths()
 }
 
 void
-Search::saveEnumPath(Path *path)
+Search::saveEnumPath(PathCopy *path)
 {
+  LockGuard lock(enum_paths_lock_);
   enum_paths_.push_back(path);
 }
 
@@ -451,8 +461,7 @@ Search::saveEnumPath(Path *path)
 void
 Search::deletePathsIncr(Vertex *vertex)
 {
-  tnsNotifyBefore(vertex);
-  if (worst_slacks_)
+  if (worst_slacks_ && isEndpoint(vertex))
     worst_slacks_->worstSlackNotifyBefore(vertex);
   deletePaths(vertex);
 }
@@ -464,6 +473,8 @@ Search::deletePaths(Vertex *vertex)
              vertex->to_string(this));
   TagGroup *tag_group = tagGroup(vertex);
   if (tag_group) {
+    path_pool_->destroy(graph_->id(vertex), vertex->paths(),
+                        tag_group->pathCount());
     vertex->deletePaths();
     tag_group->decrRefCount();
   }
@@ -605,7 +616,7 @@ void
 Search::deleteTagGroup(TagGroup *group)
 {
   tag_group_set_->erase(group);
-  tag_groups_[group->index()] = nullptr;
+  tag_groups_.set(group->index(), nullptr);
   tag_group_free_indices_.push_back(group->index());
   delete group;
 }
@@ -616,7 +627,7 @@ Search::deleteFilterTags()
   for (TagIndex i = 0; i < tag_next_; i++) {
     Tag *tag = tags_[i];
     if (tag && (tag->isFilter() || tag->clkInfo()->crprPathRefsFilter())) {
-      tags_[i] = nullptr;
+      tags_.set(i, nullptr);
       tag_set_->erase(tag);
       delete tag;
     }
@@ -626,14 +637,14 @@ Search::deleteFilterTags()
 void
 Search::deleteFilterClkInfos()
 {
-  for (auto itr = clk_info_set_->cbegin(); itr != clk_info_set_->cend();) {
-    const ClkInfo *clk_info = *itr;
-    if (clk_info->crprPathRefsFilter()) {
-      itr = clk_info_set_->erase(itr);
-      delete clk_info;
-    }
-    else
-      itr++;
+  std::vector<const ClkInfo *> filter_clk_infos;
+  clk_info_set_->forEach([&](const ClkInfo *clk_info) {
+    if (clk_info->crprPathRefsFilter())
+      filter_clk_infos.push_back(clk_info);
+  });
+  for (const ClkInfo *clk_info : filter_clk_infos) {
+    clk_info_set_->erase(clk_info);
+    delete clk_info;
   }
 }
 
@@ -672,17 +683,13 @@ Search::findFilteredArrivals(bool thru_latches)
   }
 }
 
-// Delete stale tag arrarys.
+// Delete stale tag hash tables.
 void
 Search::deleteTagsPrev()
 {
-  for (Tag **tags : tags_prev_)
-    delete[] tags;
-  tags_prev_.clear();
-
-  for (TagGroup **tag_groups : tag_groups_prev_)
-    delete[] tag_groups;
-  tag_groups_prev_.clear();
+  tag_set_->deleteRetired();
+  tag_group_set_->deleteRetired();
+  clk_info_set_->deleteRetired();
 }
 
 void
@@ -829,7 +836,6 @@ Search::arrivalsInvalid()
     // No need to keep track of incremental updates any more.
     invalid_arrivals_.clear();
     invalid_requireds_.clear();
-    tns_exists_ = false;
     clearWorstSlack();
     invalid_tns_.clear();
   }
@@ -842,7 +848,6 @@ Search::requiredsInvalid()
   requireds_exist_ = false;
   requireds_seeded_ = false;
   invalid_requireds_.clear();
-  tns_exists_ = false;
   clearWorstSlack();
   invalid_tns_.clear();
 }
@@ -1200,7 +1205,9 @@ void
 Search::findArrivals2(Level level)
 {
   Stats stats(debug_, report_);
-  int arrival_count = arrival_iter_->visitParallel(level, arrival_visitor_);
+  int arrival_count = variables_->dataflowPropagation()
+    ? arrival_iter_->visitDataflow(level, arrival_visitor_)
+    : arrival_iter_->visitParallel(level, arrival_visitor_);
   deleteTagsPrev();
   if (arrival_count > 0)
     deleteUnusedTagGroups();
@@ -1466,7 +1473,7 @@ Search::arrivalsChanged(Vertex *vertex,
           || !delayEqual(path1->arrival(), path2->arrival(), this)
           || path1->prevEdge(this) != path2->prevEdge(this)
           || path1->prevArc(this) != path2->prevArc(this)
-          || path1->prevPath() != path2->prevPath())
+          || path1->prevPath(this) != path2->prevPath(this))
         return true;
     }
     return false;
@@ -2435,7 +2442,7 @@ Search::pathClkPathArrival1(const Path *path) const
 {
   const Path *p = path;
   while (p) {
-    Path *prev_path = p->prevPath();
+    Path *prev_path = p->prevPath(this);
     Edge *prev_edge = p->prevEdge(this);
 
     if (p->isClock(this))
@@ -2444,7 +2451,7 @@ Search::pathClkPathArrival1(const Path *path) const
       const TimingRole *prev_role = prev_edge->role();
       if (prev_role == TimingRole::regClkToQ()
           || prev_role == TimingRole::latchEnToQ()) {
-        return p->prevPath();
+        return p->prevPath(this);
       }
       else if (prev_role == TimingRole::latchDtoQ()) {
         Path *enable_path = latches_->latchEnablePath(p, prev_edge);
@@ -2794,35 +2801,25 @@ TagGroup *
 Search::findTagGroup(TagGroupBldr *tag_bldr)
 {
   TagGroup probe(tag_bldr, this);
-  LockGuard lock(tag_group_lock_);
-  TagGroup *tag_group = findKey(*tag_group_set_, &probe);
-  if (tag_group == nullptr) {
+  return tag_group_set_->findOrInsert(&probe, [&]() {
     TagGroupIndex tag_group_index;
-    if (tag_group_free_indices_.empty())
-      tag_group_index = tag_group_next_++;
-    else {
-      tag_group_index = tag_group_free_indices_.back();
-      tag_group_free_indices_.pop_back();
-    }
-    tag_group = tag_bldr->makeTagGroup(tag_group_index, this);
-    tag_groups_[tag_group_index] = tag_group;
-    tag_group_set_->insert(tag_group);
-    // If tag_groups_ needs to grow make the new array and copy the
-    // contents into it before updating tags_groups_ so that other threads
-    // can use Search::tagGroup(TagGroupIndex) without returning gubbish.
-    if (tag_group_next_ == tag_group_capacity_) {
-      TagGroupIndex tag_capacity = tag_group_capacity_ * 2;
-      TagGroup **tag_groups = new TagGroup *[tag_capacity];
-      std::copy_n(tag_groups_.load(), tag_group_capacity_, tag_groups);
-      tag_groups_prev_.push_back(tag_groups_);
-      tag_groups_ = tag_groups;
-      tag_group_capacity_ = tag_capacity;
-      tag_group_set_->reserve(tag_capacity);
+    {
+      LockGuard lock(tag_group_index_lock_);
+      if (tag_group_free_indices_.empty())
+        tag_group_index = tag_group_next_++;
+      else {
+        tag_group_index = tag_group_free_indices_.back();
+        tag_group_free_indices_.pop_back();
+      }
     }
-    if (tag_group_next_ > tag_group_index_max)
+    if (tag_group_index >= tag_group_index_max)
       report_->critical(1510, "max tag group index exceeded");
-  }
-  return tag_group;
+    TagGroup *tag_group = tag_bldr->makeTagGroup(tag_group_index, this);
+    // Make sure the tag group can be indexed in tag_groups_ before it
+    // is visible to other threads via tag_group_set_.
+    tag_groups_.set(tag_group_index, tag_group);
+    return tag_group;
+  });
 }
 
 void
@@ -2840,13 +2837,16 @@ Search::setVertexArrivals(Vertex *vertex,
       requiredInvalid(vertex);
     }
     else {
+      VertexId vertex_id = graph_->id(vertex);
       if (prev_tag_group) {
+        path_pool_->destroy(vertex_id, prev_paths, prev_tag_group->pathCount());
         vertex->deletePaths();
         prev_tag_group->decrRefCount();
         requiredInvalid(vertex);
       }
       size_t path_count = tag_group->pathCount();
-      Path *paths = vertex->makePaths(path_count);
+      Path *paths = path_pool_->make(vertex_id, path_count);
+      vertex->setPaths(paths);
       tag_bldr->copyPaths(tag_group, paths);
       vertex->setTagGroupIndex(tag_group->index());
       tag_group->incrRefCount();
@@ -2918,7 +2918,7 @@ Search::reportArrivals(Vertex *vertex,
       bool report_prev = true;
       std::string prev_str;
       if (report_prev) {
-        Path *prev_path = path->prevPath();
+        Path *prev_path = path->prevPath(this);
         if (prev_path) {
           const Edge *prev_edge = path->prevEdge(this);
           TimingArc *arc = path->prevArc(this);
@@ -2972,18 +2972,12 @@ Search::reportTagGroups() const
   for (TagGroupIndex i = 0; i < tag_group_next_; i++) {
     TagGroup *tag_group = tag_groups_[i];
     if (tag_group) {
-      report_->report("Group {:4} hash = {:4} ({:4})", i, tag_group->hash(),
-                      tag_group->hash() % tag_group_set_->bucket_count());
+      report_->report("Group {:4} hash = {:4}", i, tag_group->hash());
       tag_group->reportArrivalMap(this);
     }
   }
-  size_t long_hash = 0;
-  for (size_t i = 0; i < tag_group_set_->bucket_count(); i++) {
-    if (tag_group_set_->bucket_size(i) > long_hash)
-      long_hash = i;
-  }
-  report_->report("Longest hash bucket length {} hash={}",
-                  tag_group_set_->bucket_size(long_hash), long_hash);
+  report_->report("{} tag groups {} locks {} contended", tag_group_set_->size(),
+                  tag_group_set_->lockCount(), tag_group_set_->contendedCount());
 }
 
 void
@@ -3009,6 +3003,18 @@ Search::reportPathCountHistogram() const
   }
 }
 
+void
+Search::reportSearchMemory() const
+{
+  path_pool_->reportMemory(report_);
+  report_->report("Tags       {:10} {:10} locks {:10} contended", tagCount(),
+                  tag_set_->lockCount(), tag_set_->contendedCount());
+  report_->report("Tag groups {:10} {:10} locks {:10} contended", tagGroupCount(),
+                  tag_group_set_->lockCount(), tag_group_set_->contendedCount());
+  report_->report("Clk infos  {:10} {:10} locks {:10} contended", clkInfoCount(),
+                  clk_info_set_->lockCount(), clk_info_set_->contendedCount());
+}
+
 ////////////////////////////////////////////////////////////////
 
 Tag *
@@ -3043,43 +3049,50 @@ Search::findTag(Scene *scene,
       return tag;
   }
 
-  LockGuard lock(tag_lock_);
-  Tag *tag = findKey(*tag_set_, &probe);
+  Tag *tag = tag_set_->find(&probe);
   if (tag == nullptr) {
-    // Make rise/fall versions of the tag to avoid tag_set lookups when the
-    // only change is the rise/fall edge.
-    for (const RiseFall *rf1 : RiseFall::range()) {
-      ExceptionStateSet *new_states =
-          !own_states && states ? new ExceptionStateSet(*states) : states;
-      TagIndex tag_index = tag_next_++;
-      Tag *tag1 = new Tag(scene, tag_index, rf1, min_max, clk_info, is_clk,
-                          input_delay, is_segment_start, new_states, true);
-      own_states = false;
-      // Make sure tag can be indexed in tags_ before it is visible to
-      // other threads via tag_set_.
-      tags_[tagsTableRfIndex(tag_index, rf1)] = tag1;
-      tag_set_->insert(tag1);
-      if (tag_cache)
-        tag_cache->insert(tag1);
-      if (rf1 == rf)
-        tag = tag1;
-
-      if (tag_next_ == tag_index_max)
+    // The rise/fall versions of the tag are made together so lock the
+    // shards of both. Lock in shard order to avoid deadlock.
+    Tag probe_opposite(scene, 0, rf->opposite(), min_max, clk_info, is_clk,
+                       input_delay, is_segment_start, states, false);
+    size_t shard1 = tag_set_->shardIndex(&probe);
+    size_t shard2 = tag_set_->shardIndex(&probe_opposite);
+    if (shard1 > shard2)
+      std::swap(shard1, shard2);
+    tag_set_->lockShard(shard1);
+    if (shard2 != shard1)
+      tag_set_->lockShard(shard2);
+    // Another thread may have made the tag after the lock free find.
+    tag = tag_set_->find(&probe);
+    if (tag == nullptr) {
+      TagIndex tag_index = tag_next_.fetch_add(RiseFall::index_count);
+      if (tag_index + RiseFall::index_count >= tag_index_max)
         report_->critical(1511, "max tag index exceeded");
+      // Make rise/fall versions of the tag to avoid tag_set lookups when the
+      // only change is the rise/fall edge.
+      Tag *tags[RiseFall::index_count];
+      for (const RiseFall *rf1 : RiseFall::range()) {
+        ExceptionStateSet *new_states =
+            !own_states && states ? new ExceptionStateSet(*states) : states;
+        Tag *tag1 = new Tag(scene, tag_index + rf1->index(), rf1, min_max,
+                            clk_info, is_clk, input_delay, is_segment_start,
+                            new_states, true);
+        own_states = false;
+        // Make sure tag can be indexed in tags_ before it is visible to
+        // other threads via tag_set_.
+        tags_.set(tagsTableRfIndex(tag1->index(), rf1), tag1);
+        tags[rf1->index()] = tag1;
+      }
+      for (Tag *tag1 : tags) {
+        tag_set_->insert(tag1);
+        if (tag_cache)
+          tag_cache->insert(tag1);
+      }
+      tag = tags[rf->index()];
     }
-
-    // If tags_ needs to grow make the new array and copy the
-    // contents into it before updating tags_ so that other threads
-    // can use Search::tag(TagIndex) without returning gubbish.
-    if (tag_next_ == tag_capacity_) {
-      TagIndex tag_capacity = tag_capacity_ * 2;
-      Tag **tags = new Tag *[tag_capacity];
-      std::copy_n(tags_.load(), tag_capacity_, tags);
-      tags_prev_.push_back(tags_);
-      tags_ = tags;
-      tag_capacity_ = tag_capacity;
-      tag_set_->reserve(tag_capacity);
-    }
+    if (shard2 != shard1)
+      tag_set_->unlockShard(shard2);
+    tag_set_->unlockShard(shard1);
   }
   if (own_states)
     delete states;
@@ -3094,13 +3107,8 @@ Search::reportTags() const
     if (tag)
       report_->report("{}", tag->to_string(this));
   }
-  size_t long_hash = 0;
-  for (size_t i = 0; i < tag_set_->bucket_count(); i++) {
-    if (tag_set_->bucket_size(i) > long_hash)
-      long_hash = i;
-  }
-  report_->report("Longest hash bucket length {} hash={}",
-                  tag_set_->bucket_size(long_hash), long_hash);
+  report_->report("{} tags {} locks {} contended", tag_set_->size(),
+                  tag_set_->lockCount(), tag_set_->contendedCount());
 }
 
 void
@@ -3108,8 +3116,9 @@ Search::reportClkInfos() const
 {
   std::vector<const ClkInfo *> clk_infos;
   // set -> vector for sorting.
-  for (const ClkInfo *clk_info : *clk_info_set_)
+  clk_info_set_->forEach([&](const ClkInfo *clk_info) {
     clk_infos.push_back(clk_info);
+  });
   sort(clk_infos, ClkInfoLess(this));
   for (const ClkInfo *clk_info : clk_infos)
     report_->report("{}", clk_info->to_string(this));
@@ -3133,15 +3142,11 @@ Search::findClkInfo(Scene *scene,
   const ClkInfo probe(scene, clk_edge, clk_src, is_propagated, gen_clk_src,
                       gen_clk_src_path, pulse_clk_sense, insertion, latency,
                       uncertainties, min_max, crpr_clk_path, this);
-  LockGuard lock(clk_info_lock_);
-  const ClkInfo *clk_info = findKey(*clk_info_set_, &probe);
-  if (clk_info == nullptr) {
-    clk_info = new ClkInfo(scene, clk_edge, clk_src, is_propagated, gen_clk_src,
-                           gen_clk_src_path, pulse_clk_sense, insertion, latency,
-                           uncertainties, min_max, crpr_clk_path, this);
-    clk_info_set_->insert(clk_info);
-  }
-  return clk_info;
+  return clk_info_set_->findOrInsert(&probe, [&]() {
+    return new ClkInfo(scene, clk_edge, clk_src, is_propagated, gen_clk_src,
+                       gen_clk_src_path, pulse_clk_sense, insertion, latency,
+                       uncertainties, min_max, crpr_clk_path, this);
+  });
 }
 
 const ClkInfo *
@@ -3297,18 +3302,46 @@ Search::findRequireds(Level level)
 {
   Stats stats(debug_, report_);
   debugPrint(debug_, "search", 1, "find requireds to level {}", level);
-  RequiredVisitor req_visitor(this);
+  // Changes are only pruned by the tolerance when updating requireds.
+  RequiredVisitor req_visitor(requiredTolerance(), this);
   required_iter_->ensureSize();
+  required_changed_count_ = 0;
+  required_pruned_count_ = 0;
   if (!requireds_seeded_)
     seedRequireds();
   seedInvalidRequireds();
   int required_count = required_iter_->visitParallel(level, &req_visitor);
   deleteTagsPrev();
   requireds_exist_ = true;
-  debugPrint(debug_, "search", 1, "found {} requireds", required_count);
+  debugPrint(debug_, "search", 1, "found {} requireds {} changed {} pruned",
+             required_count,
+             required_changed_count_.load(),
+             required_pruned_count_.load());
   stats.report("Find requireds");
 }
 
+float
+Search::requiredTolerance() const
+{
+  return requireds_seeded_ ? incremental_required_tolerance_ : 0.0;
+}
+
+void
+Search::setIncrementalRequiredTolerance(float tolerance)
+{
+  incremental_required_tolerance_ = tolerance;
+}
+
+void
+Search::requiredVisited(bool changed,
+                        bool pruned)
+{
+  if (changed)
+    required_changed_count_.fetch_add(1, std::memory_order_relaxed);
+  else if (pruned)
+    required_pruned_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
 void
 Search::seedRequireds()
 {
@@ -3488,7 +3521,7 @@ Search::seedRequired(Vertex *vertex)
   visit_path_ends_->visitPathEnds(vertex, &seeder);
   // Enqueue fanin vertices for back-propagating required times.
   required_iter_->ensureSize();
-  if (required_cmp.requiredsSave(vertex, this))
+  if (required_cmp.requiredsSave(vertex, requiredTolerance(), this))
     required_iter_->enqueueFanin(vertex);
 }
 
@@ -3500,7 +3533,7 @@ Search::seedRequiredEnqueueFanin(Vertex *vertex)
   required_cmp.requiredsInit(vertex, this);
   visit_path_ends_->visitPathEnds(vertex, &seeder);
   // Enqueue fanin vertices for back-propagating required times.
-  required_cmp.requiredsSave(vertex, this);
+  required_cmp.requiredsSave(vertex, 0.0, this);
   required_iter_->enqueueFanin(vertex);
 }
 
@@ -3537,26 +3570,50 @@ RequiredCmp::requiredSet(size_t path_index,
   }
 }
 
+static bool
+requiredExceedsTolerance(const Required &prev_req,
+                         const Required &req,
+                         float tolerance)
+{
+  return tolerance == 0.0
+    || std::abs(delayAsFloat(req) - delayAsFloat(prev_req)) > tolerance;
+}
+
 bool
 RequiredCmp::requiredsSave(Vertex *vertex,
+                           float tolerance,
                            const StaState *sta)
 {
   bool requireds_changed = false;
+  bool requireds_pruned = false;
   Debug *debug = sta->debug();
   VertexPathIterator path_iter(vertex, sta);
   while (path_iter.hasNext()) {
     Path *path = path_iter.next();
     size_t path_index = path->pathIndex(sta);
-    const Required req = requireds_[path_index];
+    const Required &req = requireds_[path_index];
     const Required &prev_req = path->required();
     bool changed = !delayEqual(prev_req, req, sta);
+    bool pruned = changed
+      && !requiredExceedsTolerance(prev_req, req, tolerance);
     debugPrint(debug, "search", 3, "required {} save {} -> {}{}",
                path->to_string(sta),
                delayAsString(prev_req, sta),
                delayAsString(req, sta),
-               changed ? " changed" : "");
-    requireds_changed |= changed;
-    path->setRequired(req);
+               pruned ? " pruned" : (changed ? " changed" : ""));
+    requireds_changed |= changed && !pruned;
+    requireds_pruned |= pruned;
+  }
+  requireds_pruned_ = requireds_pruned && !requireds_changed;
+  // Requireds that changed within the tolerance are not saved so they
+  // stay the ones last propagated to the fanin and small changes cannot
+  // accumulate without being propagated.
+  if (!requireds_pruned_) {
+    VertexPathIterator path_iter(vertex, sta);
+    while (path_iter.hasNext()) {
+      Path *path = path_iter.next();
+      path->setRequired(requireds_[path->pathIndex(sta)]);
+    }
   }
   return requireds_changed;
 }
@@ -3569,15 +3626,18 @@ RequiredCmp::required(size_t path_index)
 
 ////////////////////////////////////////////////////////////////
 
-RequiredVisitor::RequiredVisitor(const StaState *sta) :
+RequiredVisitor::RequiredVisitor(float tolerance,
+                                 const StaState *sta) :
   PathVisitor(sta),
-  visit_path_ends_(new VisitPathEnds(sta))
+  visit_path_ends_(new VisitPathEnds(sta)),
+  tolerance_(tolerance)
 {
 }
 
 RequiredVisitor::RequiredVisitor(const RequiredVisitor &required_visitor) :
   PathVisitor(required_visitor.search()->evalPred(), true, &required_visitor),
-  visit_path_ends_(new VisitPathEnds(&required_visitor))
+  visit_path_ends_(new VisitPathEnds(&required_visitor)),
+  tolerance_(required_visitor.tolerance_)
 {
 }
 
@@ -3605,7 +3665,8 @@ RequiredVisitor::visit(Vertex *vertex)
     FindEndRequiredVisitor seeder(required_cmp_, this);
     visit_path_ends_->visitPathEnds(vertex, &seeder);
   }
-  bool changed = required_cmp_.requiredsSave(vertex, this);
+  bool changed = required_cmp_.requiredsSave(vertex, tolerance_, this);
+  search_->requiredVisited(changed, required_cmp_.requiredsPruned());
   search_->tnsInvalid(vertex);
 
   if (changed)
@@ -3844,174 +3905,109 @@ Search::groupPathsTo(const PathEnd *path_end) const
 Slack
 Search::totalNegativeSlack(const MinMax *min_max)
 {
-  tnsPreamble();
-  DelayDbl tns = 0.0;
-  for (Scene *scene : scenes_) {
-    size_t path_index = scene->pathIndex(min_max);
-    DelayDbl tns1 = tns_[path_index];
-    if (delayLess(tns1, tns, this))
-      tns = tns1;
-  }
-  return delayDblAsDelay(tns);
+  worstSlackPreamble();
+  return worst_slacks_->totalNegativeSlack(min_max);
 }
 
 Slack
 Search::totalNegativeSlack(const Scene *scene,
                            const MinMax *min_max)
 {
-  tnsPreamble();
-  PathAPIndex path_ap_index = scene->pathIndex(min_max);
-  return delayDblAsDelay(tns_[path_ap_index]);
+  worstSlackPreamble();
+  return worst_slacks_->totalNegativeSlack(scene, min_max);
 }
 
 void
-Search::tnsPreamble()
+Search::worstSlack(const MinMax *min_max,
+                   // Return values.
+                   Slack &worst_slack,
+                   Vertex *&worst_vertex)
 {
-  wnsTnsPreamble();
-  size_t path_count = scenePathCount();
-  tns_.resize(path_count);
-  tns_slacks_.resize(path_count);
-  if (tns_exists_)
-    updateInvalidTns();
-  else
-    findTotalNegativeSlacks();
+  worstSlackPreamble();
+  worst_slacks_->worstSlack(min_max, worst_slack, worst_vertex);
 }
 
 void
-Search::tnsInvalid(Vertex *vertex)
+Search::worstSlack(const Scene *scene,
+                   const MinMax *min_max,
+                   // Return values.
+                   Slack &worst_slack,
+                   Vertex *&worst_vertex)
 {
-  if ((tns_exists_ || worst_slacks_) && isEndpoint(vertex)) {
-    debugPrint(debug_, "tns", 2, "tns invalid {}", vertex->to_string(this));
-    LockGuard lock(tns_lock_);
-    invalid_tns_.insert(vertex);
-  }
+  worstSlackPreamble();
+  worst_slacks_->worstSlack(scene, min_max, worst_slack, worst_vertex);
 }
 
 void
-Search::updateInvalidTns()
+Search::worstSlackVertices(const Scene *scene,
+                           const MinMax *min_max,
+                           size_t count,
+                           // Return value.
+                           VertexSeq &vertices)
 {
-  size_t path_count = scenePathCount();
-  for (Vertex *vertex : invalid_tns_) {
-    // Network edits can change endpointedness since tnsInvalid was called.
-    if (isEndpoint(vertex)) {
-      debugPrint(debug_, "tns", 2, "update tns {}", vertex->to_string(this));
-      SlackSeq slacks(path_count);
-      wnsSlacks(vertex, slacks);
-
-      if (tns_exists_)
-        updateTns(vertex, slacks);
-      if (worst_slacks_)
-        worst_slacks_->updateWorstSlacks(vertex, slacks);
-    }
-  }
-  invalid_tns_.clear();
+  worstSlackPreamble();
+  worst_slacks_->worstSlackVertices(scene, min_max, count, vertices);
 }
 
 void
-Search::findTotalNegativeSlacks()
+Search::slackHistogram(const Scene *scene,
+                       const MinMax *min_max,
+                       const SlackSeq &bin_maxes,
+                       // Return value.
+                       std::vector<size_t> &counts)
 {
-  size_t path_count = scenePathCount();
-  for (size_t i = 0; i < path_count; i++) {
-    tns_[i] = 0.0;
-    tns_slacks_[i].clear();
-  }
-  for (Vertex *vertex : endpoints()) {
-    // No locking required.
-    SlackSeq slacks(path_count);
-    wnsSlacks(vertex, slacks);
-    for (size_t i = 0; i < path_count; i++)
-      tnsIncr(vertex, slacks[i], i);
-  }
-  tns_exists_ = true;
+  worstSlackPreamble();
+  worst_slacks_->slackHistogram(scene, min_max, bin_maxes, counts);
 }
 
 void
-Search::updateTns(Vertex *vertex,
-                  SlackSeq &slacks)
+Search::worstSlackPreamble()
 {
-  size_t path_count = scenePathCount();
-  for (size_t i = 0; i < path_count; i++) {
-    tnsDecr(vertex, i);
-    tnsIncr(vertex, slacks[i], i);
-  }
+  wnsTnsPreamble();
+  if (worst_slacks_)
+    updateInvalidTns();
+  else
+    findWorstSlacks();
 }
 
 void
-Search::tnsIncr(Vertex *vertex,
-                Slack slack,
-                PathAPIndex path_ap_index)
+Search::findWorstSlacks()
 {
-  if (delayLess(slack, 0.0, this)) {
-    debugPrint(debug_, "tns", 3, "tns+ {} {}",
-               delayAsString(slack, this),
-               vertex->to_string(this));
-    delayIncr(tns_[path_ap_index], slack, this);
-    if (tns_slacks_[path_ap_index].contains(vertex))
-      report_->critical(1513, "tns incr existing vertex");
-    tns_slacks_[path_ap_index][vertex] = slack;
+  debugPrint(debug_, "wns", 1, "find worst slacks");
+  worst_slacks_ = new WorstSlacks(this);
+  SlackSeq slacks(scenePathCount());
+  for (Vertex *vertex : endpoints()) {
+    // No locking required.
+    wnsSlacks(vertex, slacks);
+    worst_slacks_->updateWorstSlacks(vertex, slacks);
   }
 }
 
 void
-Search::tnsDecr(Vertex *vertex,
-                PathAPIndex path_ap_index)
-{
-  Slack slack;
-  bool found;
-  findKeyValue(tns_slacks_[path_ap_index], vertex, slack, found);
-  if (found
-      && delayLess(slack, 0.0, this)) {
-    debugPrint(debug_, "tns", 3, "tns- {} {}",
-               delayAsString(slack, this),
-               vertex->to_string(this));
-    delayDecr(tns_[path_ap_index], slack, this);
-    tns_slacks_[path_ap_index].erase(vertex);
+Search::tnsInvalid(Vertex *vertex)
+{
+  if (worst_slacks_ && isEndpoint(vertex)) {
+    debugPrint(debug_, "tns", 2, "tns invalid {}", vertex->to_string(this));
+    LockGuard lock(tns_lock_);
+    invalid_tns_.insert(vertex);
   }
 }
 
-// Notify tns before updating/deleting slack (arrival/required).
 void
-Search::tnsNotifyBefore(Vertex *vertex)
+Search::updateInvalidTns()
 {
-  if (tns_exists_ && isEndpoint(vertex)) {
-    size_t path_count = scenePathCount();
-    for (size_t i = 0; i < path_count; i++) {
-      tnsDecr(vertex, i);
+  SlackSeq slacks(scenePathCount());
+  for (Vertex *vertex : invalid_tns_) {
+    // Network edits can change endpointedness since tnsInvalid was called.
+    if (isEndpoint(vertex)) {
+      debugPrint(debug_, "tns", 2, "update tns {}", vertex->to_string(this));
+      wnsSlacks(vertex, slacks);
+      worst_slacks_->updateWorstSlacks(vertex, slacks);
     }
+    else
+      worst_slacks_->worstSlackNotifyBefore(vertex);
   }
-}
-
-////////////////////////////////////////////////////////////////
-
-void
-Search::worstSlack(const MinMax *min_max,
-                   // Return values.
-                   Slack &worst_slack,
-                   Vertex *&worst_vertex)
-{
-  worstSlackPreamble();
-  worst_slacks_->worstSlack(min_max, worst_slack, worst_vertex);
-}
-
-void
-Search::worstSlack(const Scene *scene,
-                   const MinMax *min_max,
-                   // Return values.
-                   Slack &worst_slack,
-                   Vertex *&worst_vertex)
-{
-  worstSlackPreamble();
-  worst_slacks_->worstSlack(scene, min_max, worst_slack, worst_vertex);
-}
-
-void
-Search::worstSlackPreamble()
-{
-  wnsTnsPreamble();
-  if (worst_slacks_)
-    updateInvalidTns();
-  else
-    worst_slacks_ = new WorstSlacks(this);
+  invalid_tns_.clear();
 }
 
 void
@@ -147,6 +147,12 @@ find_timing_cmd(bool full)
   Sta::sta()->updateTiming(full);
 }
 
+void
+compact_graph()
+{
+  Sta::sta()->compactGraph();
+}
+
 void
 arrivals_invalid()
 {
@@ -197,6 +203,56 @@ worst_slack_cmd(const MinMax *min_max)
   return delayAsFloat(worst_slack, min_max, sta);
 }
 
+void
+set_incremental_required_tolerance_cmd(float tol)
+{
+  Sta::sta()->setIncrementalRequiredTolerance(tol);
+}
+
+void
+report_required_updates_cmd()
+{
+  Sta *sta = Sta::sta();
+  Search *search = sta->search();
+  Report *report = sta->report();
+  report->report("requireds changed {}", search->requiredChangedCount());
+  report->report("requireds pruned {}", search->requiredPrunedCount());
+}
+
+void
+report_worst_slack_endpoints_cmd(Scene *scene,
+                                 const MinMax *min_max,
+                                 int count,
+                                 int digits)
+{
+  Sta *sta = Sta::sta();
+  Report *report = sta->report();
+  const Network *network = sta->network();
+  const SceneSeq scenes{scene};
+  for (Vertex *vertex : sta->worstSlackVertices(scene, min_max, count)) {
+    Slack slack = sta->slack(vertex, RiseFallBoth::riseFall(), scenes, min_max);
+    report->report("{:>10} {}",
+                   delayAsString(slack, min_max, digits, sta),
+                   network->pathName(vertex->pin()));
+  }
+}
+
+void
+report_slack_histogram_cmd(Scene *scene,
+                           const MinMax *min_max,
+                           FloatSeq bin_maxes,
+                           int digits)
+{
+  Sta *sta = Sta::sta();
+  Report *report = sta->report();
+  SlackSeq slack_maxes(bin_maxes.begin(), bin_maxes.end());
+  std::vector<size_t> counts = sta->slackHistogram(scene, min_max, slack_maxes);
+  for (size_t bin = 0; bin < counts.size(); bin++)
+    report->report("<= {:>10} {}",
+                   delayAsString(slack_maxes[bin], min_max, digits, sta),
+                   counts[bin]);
+}
+
 Vertex *
 worst_slack_vertex(const MinMax *min_max)
 {
@@ -297,6 +353,12 @@ report_path_count_histogram()
   Sta::sta()->search()->reportPathCountHistogram();
 }
 
+void
+report_search_memory()
+{
+  Sta::sta()->search()->reportSearchMemory();
+}
+
 int
 tag_count()
 {
@@ -1310,6 +1372,30 @@ set_pin_name_compatibility(bool enable)
   Sta::sta()->setPinNameCompatibility(enable);
 }
 
+bool
+dataflow_propagation()
+{
+  return Sta::sta()->dataflowPropagation();
+}
+
+void
+set_dataflow_propagation(bool enable)
+{
+  Sta::sta()->setDataflowPropagation(enable);
+}
+
+bool
+concurrent_modes()
+{
+  return Sta::sta()->concurrentModes();
+}
+
+void
+set_concurrent_modes(bool enable)
+{
+  Sta::sta()->setConcurrentModes(enable);
+}
+
 bool
 pin_name_compat_match(const char *pattern,
                       const Pin *pin,
@@ -1453,7 +1539,7 @@ pins()
   Path *path1 = self;
   while (path1) {
     pins.push_back(path1->vertex(sta)->pin());
-    path1 = path1->prevPath();
+    path1 = path1->prevPath(sta);
   }
   return pins;
 }
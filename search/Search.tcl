@@ -104,6 +104,11 @@ proc find_timing { args } {
 
 ################################################################
 
+define_cmd_args "compact_graph" {} \
+  -help {The `compact_graph` command rebuilds the timing graph with vertices and edges numbered in level order so that pins that are visited together are near each other in memory. This improves cache locality for delay calculation and search on large designs. All timing is invalidated. Delays and slews annotated with `read_sdf`, `set_assigned_delay`, `set_assigned_check` and `set_assigned_transition` are kept.}
+
+################################################################
+
 define_cmd_args "find_timing_paths" \
   {[-from from_list|-rise_from from_list|-fall_from from_list]\
      [-through through_list|-rise_through through_list|-fall_through through_list]\
@@ -641,6 +646,11 @@ proc_redirect report_check_types {
 
 ################################################################
 
+define_cmd_args "report_search_memory" {} \
+  -help {The `report_search_memory` command reports the memory used by the vertex path arrays made by the arrival search, how much of it holds paths and how much is free for reuse, along with the tag, tag group and clock info counts.}
+
+################################################################
+
 define_cmd_args "report_disabled_edges" {} \
   -help {The `report_disabled_edges` command reports disabled timing arcs along with the reason they are disabled. Each disabled timing arc is reported as the instance name along with the from and to ports of the arc. The disable reason is shown next. Arcs that are disabled with `set_disable_timing` are reported with constraint as the reason. Arcs that are disabled by constants are reported with constant as the reason along with the constant instance pin and value. Arcs that are disabled to break combinational feedback loops are reported with loop as the reason.
 
@@ -727,6 +737,88 @@ proc_redirect report_worst_slack {
 
 ################################################################
 
+define_cmd_args "set_incremental_required_tolerance" {tolerance} \
+  -help {Required times that change by less than tolerance during incremental updates are not saved or propagated to their fanin, so later updates compare against the required time that was last propagated. The default tolerance of 0 propagates every change.}
+
+proc set_incremental_required_tolerance { args } {
+  check_argc_eq1 "set_incremental_required_tolerance" $args
+  set tol [lindex $args 0]
+  check_positive_float "tolerance" $tol
+  set_incremental_required_tolerance_cmd [time_ui_sta $tol]
+}
+
+################################################################
+
+define_cmd_args "report_required_updates" {} \
+  -help {Report the number of vertices revisited by the last required time update with required times that changed and were propagated to their fanin, and with required times that changed by less than the incremental required tolerance and were pruned.}
+
+proc_redirect report_required_updates {
+  check_argc_eq0 "report_required_updates" $args
+  report_required_updates_cmd
+}
+
+################################################################
+
+define_cmd_args "report_worst_slack_endpoints" \
+  {[-scene scene] [-min] [-max] [-count count] [-digits digits]} \
+  -help {Report the constrained endpoints with the worst slacks, worst first. The default count is 10.}
+
+proc_redirect report_worst_slack_endpoints {
+  global sta_report_default_digits
+
+  parse_key_args "report_worst_slack_endpoints" args \
+    keys {-scene -count -digits} flags {-min -max}
+  check_argc_eq0 "report_worst_slack_endpoints" $args
+  set scene [parse_scene keys]
+  set min_max [parse_min_max_flags flags]
+  set count 10
+  if { [info exists keys(-count)] } {
+    set count $keys(-count)
+    check_positive_integer "-count" $count
+  }
+  if { [info exists keys(-digits)] } {
+    set digits $keys(-digits)
+    check_positive_integer "-digits" $digits
+  } else {
+    set digits $sta_report_default_digits
+  }
+  report_worst_slack_endpoints_cmd $scene $min_max $count $digits
+}
+
+################################################################
+
+define_cmd_args "report_slack_histogram" \
+  {[-scene scene] [-min] [-max] [-digits digits] bin_maxes} \
+  -help {Report the number of constrained endpoints with slack in each bin. Each bin counts the endpoints with slack greater than the previous bin max and less than or equal to its own. Endpoints with slack greater than the largest bin max are not counted.} \
+  -arg_help {
+    bin_maxes {A list of bin max slacks.}
+  }
+
+proc_redirect report_slack_histogram {
+  global sta_report_default_digits
+
+  parse_key_args "report_slack_histogram" args \
+    keys {-scene -digits} flags {-min -max}
+  check_argc_eq1 "report_slack_histogram" $args
+  set scene [parse_scene keys]
+  set min_max [parse_min_max_flags flags]
+  if { [info exists keys(-digits)] } {
+    set digits $keys(-digits)
+    check_positive_integer "-digits" $digits
+  } else {
+    set digits $sta_report_default_digits
+  }
+  set bin_maxes {}
+  foreach bin_max [lindex $args 0] {
+    check_float "bin_maxes" $bin_max
+    lappend bin_maxes [time_ui_sta $bin_max]
+  }
+  set bin_maxes [lsort -real $bin_maxes]
+  report_slack_histogram_cmd $scene $min_max $bin_maxes $digits
+}
+
+################################################################
+
 # Note that -all and -tags are intentionally "hidden".
 define_cmd_args "report_path" \
   {[-min|-max]\
@@ -266,7 +266,7 @@ Sim::setSimTimingSense(Edge *edge,
     edge_timing_sense_map_.erase(edge);
   else {
     edge_timing_sense_map_[edge] = sense;
-    edge->setHasSimSense(true);
+    graph_->setHasSimSense(edge);
   }
 }
 
@@ -707,9 +707,9 @@ Sim::setSimValue(const Pin *pin,
       Vertex *vertex, *bidirect_drvr_vertex;
       graph_->pinVertices(pin, vertex, bidirect_drvr_vertex);
       if (vertex)
-        vertex->setHasSimValue(true);
+        graph_->setHasSimValue(vertex);
       if (bidirect_drvr_vertex)
-        bidirect_drvr_vertex->setHasSimValue(true);
+        graph_->setHasSimValue(bidirect_drvr_vertex);
     }
     if (observer_)
       observer_->valueChangeAfter(pin);
@@ -792,7 +792,7 @@ Sim::setIsDisabledCond(Edge *edge,
     edge_disabled_cond_set_.erase(edge);
   else {
     edge_disabled_cond_set_.insert(edge);
-    edge->setHasDisabledCond(true);
+    graph_->setHasDisabledCond(edge);
   }
 }
 
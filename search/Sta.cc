@@ -70,6 +70,7 @@
 #include "MakeConcreteNetwork.hh"
 #include "MakeTimingModel.hh"
 #include "MinMax.hh"
+#include "Mutex.hh"
 #include "Mode.hh"
 #include "Network.hh"
 #include "NetworkClass.hh"
@@ -103,6 +104,7 @@
 #include "Wireload.hh"
 #include "liberty/LibDb.hh"
 #include "liberty/LibertyReader.hh"
+#include "liberty/TablePool.hh"
 #include "parasitics/ConcreteParasitics.hh"
 #include "parasitics/ReportParasiticAnnotation.hh"
 #include "parasitics/SpefReader.hh"
@@ -171,17 +173,26 @@ StaDelayCalcObserver::checkDelayChangedTo(Vertex *vertex)
 
 ////////////////////////////////////////////////////////////////
 
+// Modes propagate constants concurrently when sta_concurrent_modes is
+// enabled, so invalidations are serialized with a lock shared by the
+// observers of all modes.
 class StaSimObserver : public SimObserver
 {
 public:
-  StaSimObserver(StaState *sta);
+  StaSimObserver(StaState *sta,
+                 std::mutex &lock);
   void valueChangeAfter(const Pin *pin) override;
   void faninEdgesChangeAfter(const Pin *pin) override;
   void fanoutEdgesChangeAfter(const Pin *pin) override;
+
+private:
+  std::mutex &lock_;
 };
 
-StaSimObserver::StaSimObserver(StaState *sta) :
-  SimObserver(sta)
+StaSimObserver::StaSimObserver(StaState *sta,
+                               std::mutex &lock) :
+  SimObserver(sta),
+  lock_(lock)
 {
 }
 
@@ -192,6 +203,7 @@ StaSimObserver::StaSimObserver(StaState *sta) :
 void
 StaSimObserver::valueChangeAfter(const Pin *pin)
 {
+  LockGuard lock(lock_);
   graph_delay_calc_->delayInvalid(pin);
   Vertex *vertex = graph_->pinDrvrVertex(pin);
   if (vertex) {
@@ -204,6 +216,7 @@ StaSimObserver::valueChangeAfter(const Pin *pin)
 void
 StaSimObserver::faninEdgesChangeAfter(const Pin *pin)
 {
+  LockGuard lock(lock_);
   Vertex *vertex = graph_->pinDrvrVertex(pin);
   search_->arrivalInvalid(vertex);
   search_->endpointInvalid(vertex);
@@ -212,6 +225,7 @@ StaSimObserver::faninEdgesChangeAfter(const Pin *pin)
 void
 StaSimObserver::fanoutEdgesChangeAfter(const Pin *pin)
 {
+  LockGuard lock(lock_);
   Vertex *vertex = graph_->pinDrvrVertex(pin);
   search_->requiredInvalid(vertex);
   search_->endpointInvalid(vertex);
@@ -301,7 +315,7 @@ Sta::makeObservers()
 {
   graph_delay_calc_->setObserver(new StaDelayCalcObserver(search_));
   for (Mode *mode : modes_)
-    mode->sim()->setObserver(new StaSimObserver(this));
+    mode->sim()->setObserver(new StaSimObserver(this, sim_observer_lock_));
   levelize_->setObserver(new StaLevelizeObserver(search_, graph_delay_calc_));
 }
 
@@ -512,6 +526,7 @@ Sta::~Sta()
   delete report_;
   delete power_;
   delete equiv_cells_;
+  delete table_pool_;
   delete dispatch_queue_;
   delete variables_;
   delete delay_ops_;
@@ -537,10 +552,17 @@ Sta::clearSceneLiberty()
 
 void
 Sta::clearNonSdc()
+{
+  deleteParasitics();
+  deleteGraph();
+  current_instance_ = nullptr;
+}
+
+void
+Sta::deleteGraph()
 {
   // Sdc holds search filter, so clear search first.
   levelize_->clear();
-  deleteParasitics();
   graph_delay_calc_->clear();
   power_->clear();
   if (check_min_pulse_widths_)
@@ -560,7 +582,6 @@ Sta::clearNonSdc()
 
   delete graph_;
   graph_ = nullptr;
-  current_instance_ = nullptr;
   // Notify components that graph is toast.
   updateComponentsState();
 }
@@ -602,7 +623,7 @@ Sta::setCmdMode(std::string_view mode_name)
     mode_name_map_[std::string(mode_name)] = mode;
     modes_.push_back(mode);
     mode->sim()->setMode(mode);
-    mode->sim()->setObserver(new StaSimObserver(this));
+    mode->sim()->setObserver(new StaSimObserver(this, sim_observer_lock_));
     cmd_mode_ = mode;
 
     if (scenes_.size() == 1 && scenes_[0]->name() == "default")
@@ -750,7 +771,10 @@ Sta::readLibertyFile(std::string_view filename,
                      const MinMaxAll *min_max,
                      bool infer_latches)
 {
-  LibertyLibrary *liberty = sta::readLibertyFile(filename, infer_latches, network_);
+  if (table_pool_ == nullptr)
+    table_pool_ = new TablePool;
+  LibertyLibrary *liberty = sta::readLibertyFile(filename, infer_latches, network_,
+                                                 table_pool_);
   if (liberty) {
     // Don't map liberty cells if they are redefined by reading another
     // library with the same cell names.
@@ -2732,6 +2756,30 @@ Sta::setPinNameCompatibility(bool enable)
   variables_->setPinNameCompatibility(enable);
 }
 
+bool
+Sta::dataflowPropagation() const
+{
+  return variables_->dataflowPropagation();
+}
+
+void
+Sta::setDataflowPropagation(bool enable)
+{
+  variables_->setDataflowPropagation(enable);
+}
+
+bool
+Sta::concurrentModes() const
+{
+  return variables_->concurrentModes();
+}
+
+void
+Sta::setConcurrentModes(bool enable)
+{
+  variables_->setConcurrentModes(enable);
+}
+
 ////////////////////////////////////////////////////////////////
 
 // Init one scene named "default".
@@ -2747,7 +2795,7 @@ Sta::makeDefaultScene()
   modes_.push_back(mode);
   mode_name_map_[name] = mode;
   mode->sim()->setMode(mode);
-  mode->sim()->setObserver(new StaSimObserver(this));
+  mode->sim()->setObserver(new StaSimObserver(this, sim_observer_lock_));
 
   deleteScenes();
   makeScene(name, mode, parasitics);
@@ -3004,10 +3052,10 @@ void
 Sta::searchPreamble()
 {
   findDelays();
-  for (Mode *mode : modes_) {
+  visitModes([] (Mode *mode) {
     mode->sim()->ensureConstantsPropagated();
     mode->sdc()->searchPreamble();
-  }
+  });
   updateGeneratedClks();
   // Delete results from last findPathEnds because they point to filtered arrivals.
   search_->deletePathGroups();
@@ -3844,6 +3892,28 @@ Sta::worstSlack(const Scene *scene,
   search_->worstSlack(scene, min_max, worst_slack, worst_vertex);
 }
 
+VertexSeq
+Sta::worstSlackVertices(const Scene *scene,
+                        const MinMax *min_max,
+                        size_t count)
+{
+  searchPreamble();
+  VertexSeq vertices;
+  search_->worstSlackVertices(scene, min_max, count, vertices);
+  return vertices;
+}
+
+std::vector<size_t>
+Sta::slackHistogram(const Scene *scene,
+                    const MinMax *min_max,
+                    const SlackSeq &bin_maxes)
+{
+  searchPreamble();
+  std::vector<size_t> counts;
+  search_->slackHistogram(scene, min_max, bin_maxes, counts);
+  return counts;
+}
+
 ////////////////////////////////////////////////////////////////
 
 std::string
@@ -3892,9 +3962,32 @@ void
 Sta::delayCalcPreamble()
 {
   ensureLevelized();
-  for (Mode *mode : modes_) {
+  visitModes([] (Mode *mode) {
     mode->sim()->ensureConstantsPropagated();
     mode->clkNetwork()->ensureClkNetwork();
+  });
+}
+
+// Constant propagation, clock network discovery and the sdc search
+// preamble only read the graph and network, so independent modes
+// can run them at the same time with one task per mode.
+void
+Sta::visitModes(const std::function<void (Mode *mode)> &visit)
+{
+  size_t mode_count = modes_.size();
+  if (variables_->concurrentModes()
+      && thread_count_ > 1
+      && mode_count > 1) {
+    size_t task_count = std::min(mode_count, static_cast<size_t>(thread_count_));
+    dispatch_queue_->parallelFor(mode_count, task_count, 1,
+                                 [&] (size_t, size_t from, size_t to) {
+                                   for (size_t i = from; i < to; i++)
+                                     visit(modes_[i]);
+                                 });
+  }
+  else {
+    for (Mode *mode : modes_)
+      visit(mode);
   }
 }
 
@@ -3904,6 +3997,12 @@ Sta::setIncrementalDelayTolerance(float tol)
   graph_delay_calc_->setIncrementalDelayTolerance(tol);
 }
 
+void
+Sta::setIncrementalRequiredTolerance(float tol)
+{
+  search_->setIncrementalRequiredTolerance(tol);
+}
+
 ArcDelay
 Sta::arcDelay(Edge *edge,
               TimingArc *arc,
@@ -4000,7 +4099,37 @@ void
 Sta::makeGraph()
 {
   graph_ = new Graph(this, dcalcAnalysisPtCount());
-  graph_->makeGraph();
+  if (graph_pin_order_)
+    graph_->makeGraph(*graph_pin_order_);
+  else
+    graph_->makeGraph();
+}
+
+void
+Sta::compactGraph()
+{
+  if (graph_) {
+    Stats stats(debug_, report_);
+    ensureLevelized();
+    PinSeq pins;
+    pins.reserve(graph_->vertexCount());
+    for (Vertex *vertex : graph_->levelSortedVertices()) {
+      // Bidirect driver vertices are made with the load vertex.
+      if (!vertex->isBidirectDriver())
+        pins.push_back(vertex->pin());
+    }
+    // Annotations from read_sdf and set_annotated_delay/transition are
+    // kept in the graph.
+    GraphAnnotations annotations;
+    graph_->saveAnnotations(annotations);
+    deleteGraph();
+    graph_pin_order_ = &pins;
+    makeGraph();
+    graph_pin_order_ = nullptr;
+    graph_->restoreAnnotations(annotations);
+    updateComponentsState();
+    stats.report("Compact graph");
+  }
 }
 
 void
@@ -4427,7 +4556,8 @@ Sta::readSpef(std::string_view name,
               bool pin_cap_included,
               bool keep_coupling_caps,
               float coupling_cap_factor,
-              bool reduce)
+              bool reduce,
+              bool lazy)
 {
   ensureLibLinked();
   Parasitics *parasitics = nullptr;
@@ -4461,7 +4591,7 @@ Sta::readSpef(std::string_view name,
 
   bool success = readSpefFile(filename, instance, pin_cap_included,
                               keep_coupling_caps, coupling_cap_factor, reduce,
-                              scene, min_max, parasitics, this);
+                              lazy, scene, min_max, parasitics, this);
   delaysInvalid();
   return success;
 }
@@ -6048,10 +6178,10 @@ Sta::checkFanoutPreamble()
   if (check_fanouts_ == nullptr)
     makeCheckFanouts();
   ensureLevelized();
-  for (Mode *mode : modes_) {
+  visitModes([] (Mode *mode) {
     mode->sim()->ensureConstantsPropagated();
     mode->clkNetwork()->ensureClkNetwork();
-  }
+  });
 }
 
 size_t
@@ -24,18 +24,32 @@
 
 #include "WorstSlack.hh"
 
-#include <algorithm>
-
-#include "ContainerHelpers.hh"
 #include "Debug.hh"
 #include "Graph.hh"
 #include "Mutex.hh"
-#include "Report.hh"
 #include "Scene.hh"
-#include "Search.hh"
 
 namespace sta {
 
+EndpointSlackLess::EndpointSlackLess(const StaState *sta) :
+  sta_(sta)
+{
+}
+
+bool
+EndpointSlackLess::operator()(const EndpointSlack &slack1,
+                              const EndpointSlack &slack2) const
+{
+  if (delayLess(slack1.slack, slack2.slack, sta_))
+    return true;
+  if (delayLess(slack2.slack, slack1.slack, sta_))
+    return false;
+  const Graph *graph = sta_->graph();
+  return graph->id(slack1.vertex) < graph->id(slack2.vertex);
+}
+
+////////////////////////////////////////////////////////////////
+
 WorstSlacks::WorstSlacks(StaState *sta) :
   worst_slacks_(sta->scenePathCount(),
                 sta),
@@ -55,8 +69,7 @@ WorstSlacks::worstSlack(const MinMax *min_max,
     PathAPIndex path_ap_index = scene->pathIndex(min_max);
     Slack worst_slack1;
     Vertex *worst_vertex1;
-    worst_slacks_[path_ap_index].worstSlack(path_ap_index, worst_slack1,
-                                            worst_vertex1);
+    worst_slacks_[path_ap_index].worstSlack(worst_slack1, worst_vertex1);
     if (delayLess(worst_slack1, worst_slack, sta_)) {
       worst_slack = worst_slack1;
       worst_vertex = worst_vertex1;
@@ -72,7 +85,50 @@ WorstSlacks::worstSlack(const Scene *scene,
                         Vertex *&worst_vertex)
 {
   PathAPIndex path_ap_index = scene->pathIndex(min_max);
-  worst_slacks_[path_ap_index].worstSlack(path_ap_index, worst_slack, worst_vertex);
+  worst_slacks_[path_ap_index].worstSlack(worst_slack, worst_vertex);
+}
+
+Slack
+WorstSlacks::totalNegativeSlack(const MinMax *min_max)
+{
+  Slack tns = 0.0;
+  for (Scene *scene : sta_->scenes()) {
+    PathAPIndex path_ap_index = scene->pathIndex(min_max);
+    Slack tns1 = worst_slacks_[path_ap_index].totalNegativeSlack();
+    if (delayLess(tns1, tns, sta_))
+      tns = tns1;
+  }
+  return tns;
+}
+
+Slack
+WorstSlacks::totalNegativeSlack(const Scene *scene,
+                                const MinMax *min_max)
+{
+  PathAPIndex path_ap_index = scene->pathIndex(min_max);
+  return worst_slacks_[path_ap_index].totalNegativeSlack();
+}
+
+void
+WorstSlacks::worstSlackVertices(const Scene *scene,
+                                const MinMax *min_max,
+                                size_t count,
+                                // Return value.
+                                VertexSeq &vertices)
+{
+  PathAPIndex path_ap_index = scene->pathIndex(min_max);
+  worst_slacks_[path_ap_index].worstSlackVertices(count, vertices);
+}
+
+void
+WorstSlacks::slackHistogram(const Scene *scene,
+                            const MinMax *min_max,
+                            const SlackSeq &bin_maxes,
+                            // Return value.
+                            std::vector<size_t> &counts)
+{
+  PathAPIndex path_ap_index = scene->pathIndex(min_max);
+  worst_slacks_[path_ap_index].slackHistogram(bin_maxes, counts);
 }
 
 void
@@ -81,7 +137,7 @@ WorstSlacks::updateWorstSlacks(Vertex *vertex,
 {
   PathAPIndex path_ap_count = sta_->scenePathCount();
   for (PathAPIndex i = 0; i < path_ap_count; i++)
-    worst_slacks_[i].updateWorstSlack(vertex, slacks, i);
+    worst_slacks_[i].updateWorstSlack(vertex, slacks[i]);
 }
 
 void
@@ -96,219 +152,120 @@ WorstSlacks::worstSlackNotifyBefore(Vertex *vertex)
 WorstSlack::WorstSlack(StaState *sta) :
   StaState(sta),
   slack_init_(MinMax::min()->initValue()),
-  worst_slack_(slack_init_),
-  slack_threshold_(slack_init_),
-  queue_(new VertexSet(VertexIdLess(graph_)))
+  slacks_(EndpointSlackLess(this))
 {
 }
 
-WorstSlack::~WorstSlack() { delete queue_; }
-
 WorstSlack::WorstSlack(const WorstSlack &worst_slack) :
   StaState(worst_slack),
   slack_init_(MinMax::min()->initValue()),
-  worst_slack_(slack_init_),
-  slack_threshold_(slack_init_),
-  queue_(new VertexSet(VertexIdLess(graph_)))
+  slacks_(EndpointSlackLess(this))
 {
 }
 
 void
-WorstSlack::deleteVertexBefore(Vertex *vertex)
-{
-  LockGuard lock(lock_);
-  if (vertex == worst_vertex_) {
-    worst_vertex_ = nullptr;
-    worst_slack_ = slack_init_;
-  }
-  queue_->erase(vertex);
-}
-
-void
-WorstSlack::worstSlack(PathAPIndex path_ap_index,
-                       // Return values.
+WorstSlack::worstSlack(// Return values.
                        Slack &worst_slack,
                        Vertex *&worst_vertex)
 {
-  findWorstSlack(path_ap_index);
-  worst_slack = worst_slack_;
-  worst_vertex = worst_vertex_;
-}
-
-void
-WorstSlack::findWorstSlack(PathAPIndex path_ap_index)
-{
-  if (worst_vertex_ == nullptr) {
-    if (queue_->empty())
-      initQueue(path_ap_index);
-    else
-      findWorstInQueue(path_ap_index);
+  LockGuard lock(lock_);
+  if (slacks_.empty()) {
+    worst_slack = slack_init_;
+    worst_vertex = nullptr;
   }
-}
-
-void
-WorstSlack::initQueue(PathAPIndex path_ap_index)
-{
-  debugPrint(debug_, "wns", 3, "init queue");
-
-  queue_->clear();
-  worst_vertex_ = nullptr;
-  worst_slack_ = slack_init_;
-  slack_threshold_ = slack_init_;
-  for (Vertex *vertex : search_->endpoints()) {
-    Slack slack = search_->wnsSlack(vertex, path_ap_index);
-    if (!delayEqual(slack, slack_init_, this)) {
-      if (delayLess(slack, worst_slack_, this))
-        setWorstSlack(vertex, slack);
-      if (delayLessEqual(slack, slack_threshold_, this))
-        queue_->insert(vertex);
-      size_t queue_size = queue_->size();
-      if (queue_size >= max_queue_size_)
-        sortQueue(path_ap_index);
-    }
+  else {
+    const EndpointSlack &worst = *slacks_.begin();
+    worst_slack = worst.slack;
+    worst_vertex = worst.vertex;
   }
-  debugPrint(debug_, "wns", 3, "threshold {}",
-             delayAsString(slack_threshold_, MinMax::max(), this));
-  //checkQueue();
 }
 
-void
-WorstSlack::sortQueue(PathAPIndex path_ap_index)
+Slack
+WorstSlack::totalNegativeSlack()
 {
-  if (!queue_->empty()) {
-    debugPrint(debug_, "wns", 3, "sort queue");
-
-    VertexSeq vertices;
-    vertices.reserve(queue_->size());
-    for (Vertex *vertex : *queue_)
-      vertices.push_back(vertex);
-    WnsSlackLess slack_less(path_ap_index, this);
-    sort(vertices, slack_less);
-
-    size_t vertex_count = vertices.size();
-    size_t threshold_index = std::min(min_queue_size_, vertex_count - 1);
-    Vertex *threshold_vertex = vertices[threshold_index];
-    slack_threshold_ = search_->wnsSlack(threshold_vertex, path_ap_index);
-    debugPrint(debug_, "wns", 3, "threshold {}",
-               delayAsString(slack_threshold_, MinMax::max(), this));
-
-    // Reinsert vertices with slack < threshold.
-    queue_->clear();
-    for (Vertex *vertex : vertices) {
-      Slack slack = search_->wnsSlack(vertex, path_ap_index);
-      if (delayGreater(slack, slack_threshold_, this))
-        break;
-      queue_->insert(vertex);
-    }
-    max_queue_size_ = queue_->size() * 2;
-    Vertex *worst_slack_vertex = vertices[0];
-    Slack worst_slack_slack = search_->wnsSlack(worst_slack_vertex, path_ap_index);
-    setWorstSlack(worst_slack_vertex, worst_slack_slack);
-  }
+  LockGuard lock(lock_);
+  return delayDblAsDelay(tns_);
 }
 
 void
-WorstSlack::findWorstInQueue(PathAPIndex path_ap_index)
+WorstSlack::worstSlackVertices(size_t count,
+                               // Return value.
+                               VertexSeq &vertices)
 {
-  debugPrint(debug_, "wns", 3, "find worst in queue");
-
-  worst_vertex_ = nullptr;
-  worst_slack_ = slack_init_;
-  for (Vertex *vertex : *queue_) {
-    Slack slack = search_->wnsSlack(vertex, path_ap_index);
-    if (delayLess(slack, worst_slack_, this))
-      setWorstSlack(vertex, slack);
+  LockGuard lock(lock_);
+  vertices.clear();
+  for (const EndpointSlack &end_slack : slacks_) {
+    if (vertices.size() == count)
+      break;
+    vertices.push_back(end_slack.vertex);
   }
 }
 
 void
-WorstSlack::checkQueue(PathAPIndex path_ap_index)
+WorstSlack::slackHistogram(const SlackSeq &bin_maxes,
+                           // Return value.
+                           std::vector<size_t> &counts)
 {
-  VertexSeq ends;
-  for (Vertex *end : search_->endpoints()) {
-    if (delayLessEqual(search_->wnsSlack(end, path_ap_index), slack_threshold_,
-                       this))
-      ends.push_back(end);
-  }
-  WnsSlackLess slack_less(path_ap_index, this);
-  sort(ends, slack_less);
-
-  VertexSet end_set = makeVertexSet(this);
-  for (Vertex *end : ends) {
-    end_set.insert(end);
-    if (!queue_->contains(end)
-        && delayLessEqual(search_->wnsSlack(end, path_ap_index), slack_threshold_,
-                          this))
-      report_->report("WorstSlack queue missing {} {} < {}", end->to_string(this),
-                      delayAsString(search_->wnsSlack(end, path_ap_index), this),
-                      delayAsString(slack_threshold_, this));
-  }
-
-  for (Vertex *end : *queue_) {
-    if (!end_set.contains(end))
-      report_->report("WorstSlack queue extra {} {} > {}", end->to_string(this),
-                      delayAsString(search_->wnsSlack(end, path_ap_index), this),
-                      delayAsString(slack_threshold_, this));
+  LockGuard lock(lock_);
+  size_t bin_count = bin_maxes.size();
+  counts.assign(bin_count, 0);
+  size_t bin = 0;
+  // Only the endpoints with slack up to the last bin max are visited.
+  for (const EndpointSlack &end_slack : slacks_) {
+    while (bin < bin_count
+           && delayGreater(end_slack.slack, bin_maxes[bin], this))
+      bin++;
+    if (bin == bin_count)
+      break;
+    counts[bin]++;
   }
 }
 
 void
 WorstSlack::updateWorstSlack(Vertex *vertex,
-                             SlackSeq &slacks,
-                             PathAPIndex path_ap_index)
+                             Slack slack)
 {
-  // Do not touch the state unless queue has been initialized
-  if (!queue_->empty()) {
-    Slack slack = slacks[path_ap_index];
-    // Locking is required because ArrivalVisitor is called by multiple
-    // threads.
-    LockGuard lock(lock_);
-    if (worst_vertex_ && delayLess(slack, worst_slack_, this))
-      setWorstSlack(vertex, slack);
-    else if (vertex == worst_vertex_)
-      // Mark worst slack as unknown (updated by findWorstSlack().
-      worst_vertex_ = nullptr;
-
-    if (!delayEqual(slack, slack_init_, this)
-        && delayLessEqual(slack, slack_threshold_, this)) {
-      debugPrint(debug_, "wns", 3, "insert {} {}", vertex->to_string(this),
-                 delayAsString(slack, this));
-      queue_->insert(vertex);
-    }
-    else {
-      debugPrint(debug_, "wns", 3, "delete {} {}", vertex->to_string(this),
-                 delayAsString(slack, this));
-      queue_->erase(vertex);
+  LockGuard lock(lock_);
+  erase(vertex);
+  // Unconstrained endpoints are not indexed.
+  if (!delayEqual(slack, slack_init_, this)) {
+    debugPrint(debug_, "wns", 3, "insert {} {}", vertex->to_string(this),
+               delayAsString(slack, this));
+    slacks_.insert({slack, vertex});
+    vertex_slacks_[vertex] = slack;
+    if (delayLess(slack, 0.0, this)) {
+      debugPrint(debug_, "tns", 3, "tns+ {} {}",
+                 delayAsString(slack, this),
+                 vertex->to_string(this));
+      delayIncr(tns_, slack, this);
     }
-    // checkQueue(path_ap_index);
   }
 }
 
 void
-WorstSlack::setWorstSlack(Vertex *vertex,
-                          Slack slack)
-{
-  debugPrint(debug_, "wns", 3, "{} {}", vertex->to_string(this),
-             delayAsString(slack, this));
-  worst_vertex_ = vertex;
-  worst_slack_ = slack;
-}
-
-////////////////////////////////////////////////////////////////
-
-WnsSlackLess::WnsSlackLess(PathAPIndex path_ap_index,
-                           const StaState *sta) :
-  path_ap_index_(path_ap_index),
-  search_(sta->search())
+WorstSlack::deleteVertexBefore(Vertex *vertex)
 {
+  LockGuard lock(lock_);
+  erase(vertex);
 }
 
-bool
-WnsSlackLess::operator()(Vertex *vertex1,
-                         Vertex *vertex2)
+void
+WorstSlack::erase(Vertex *vertex)
 {
-  return delayLess(search_->wnsSlack(vertex1, path_ap_index_),
-                   search_->wnsSlack(vertex2, path_ap_index_), search_);
+  auto itr = vertex_slacks_.find(vertex);
+  if (itr != vertex_slacks_.end()) {
+    Slack slack = itr->second;
+    debugPrint(debug_, "wns", 3, "delete {} {}", vertex->to_string(this),
+               delayAsString(slack, this));
+    slacks_.erase({slack, vertex});
+    vertex_slacks_.erase(itr);
+    if (delayLess(slack, 0.0, this)) {
+      debugPrint(debug_, "tns", 3, "tns- {} {}",
+                 delayAsString(slack, this),
+                 vertex->to_string(this));
+      delayDecr(tns_, slack, this);
+    }
+  }
 }
 
 }  // namespace sta
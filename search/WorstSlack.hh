@@ -25,6 +25,7 @@
 #pragma once
 
 #include <mutex>
+#include <set>
 #include <vector>
 
 #include "Delay.hh"
@@ -37,10 +38,36 @@ namespace sta {
 
 class StaState;
 class WorstSlack;
-class WnsSlackLess;
 
 using WorstSlackSeq = std::vector<WorstSlack>;
 
+// Endpoint slack and vertex in the slack index.
+class EndpointSlack
+{
+public:
+  Slack slack;
+  Vertex *vertex;
+};
+
+// Order endpoint slacks worst first with ties broken by vertex id.
+class EndpointSlackLess
+{
+public:
+  EndpointSlackLess(const StaState *sta);
+  bool operator()(const EndpointSlack &slack1,
+                  const EndpointSlack &slack2) const;
+
+private:
+  const StaState *sta_;
+};
+
+using EndpointSlackSet = std::set<EndpointSlack, EndpointSlackLess>;
+
+// Endpoint slack index for each path analysis point (scene/min_max).
+// The index is filled with every constrained endpoint when it is made
+// and updated incrementally as endpoint slacks change, so the worst
+// slack, tns and worst endpoints are found without visiting every
+// endpoint.
 class WorstSlacks
 {
 public:
@@ -54,6 +81,22 @@ public:
                   // Return values.
                   Slack &worst_slack,
                   Vertex *&worst_vertex);
+  Slack totalNegativeSlack(const MinMax *min_max);
+  Slack totalNegativeSlack(const Scene *scene,
+                           const MinMax *min_max);
+  // Up to count endpoints with the worst slacks, worst first.
+  void worstSlackVertices(const Scene *scene,
+                          const MinMax *min_max,
+                          size_t count,
+                          // Return value.
+                          VertexSeq &vertices);
+  // Count endpoints with slack less than or equal to each increasing
+  // bin max and greater than the previous bin max.
+  void slackHistogram(const Scene *scene,
+                      const MinMax *min_max,
+                      const SlackSeq &bin_maxes,
+                      // Return value.
+                      std::vector<size_t> &counts);
   void updateWorstSlacks(Vertex *vertex,
                          SlackSeq &slacks);
   void worstSlackNotifyBefore(Vertex *vertex);
@@ -63,55 +106,38 @@ protected:
   const StaState *sta_;
 };
 
-class WnsSlackLess
-{
-public:
-  WnsSlackLess(PathAPIndex path_ap_index,
-               const StaState *sta);
-  bool operator()(Vertex *vertex1,
-                  Vertex *vertex2);
-
-private:
-  PathAPIndex path_ap_index_;
-  Search *search_;
-};
-
+// Endpoint slacks for one path analysis point.
 class WorstSlack : public StaState
 {
 public:
   WorstSlack(StaState *sta);
-  ~WorstSlack() override;
   WorstSlack(const WorstSlack &);
-  void worstSlack(PathAPIndex path_ap_index,
-                  // Return values.
+  void worstSlack(// Return values.
                   Slack &worst_slack,
                   Vertex *&worst_vertex);
+  Slack totalNegativeSlack();
+  void worstSlackVertices(size_t count,
+                          // Return value.
+                          VertexSeq &vertices);
+  void slackHistogram(const SlackSeq &bin_maxes,
+                      // Return value.
+                      std::vector<size_t> &counts);
   void updateWorstSlack(Vertex *vertex,
-                        SlackSeq &slacks,
-                        PathAPIndex path_ap_index);
+                        Slack slack);
   void deleteVertexBefore(Vertex *vertex);
 
 protected:
-  void findWorstSlack(PathAPIndex path_ap_index);
-  void initQueue(PathAPIndex path_ap_index);
-  void findWorstInQueue(PathAPIndex path_ap_index);
-  void setWorstSlack(Vertex *vertex,
-                     Slack slack);
-  void sortQueue(PathAPIndex path_ap_index);
-  void checkQueue(PathAPIndex path_ap_index);
+  void erase(Vertex *vertex);
 
   Slack slack_init_;
-  // Vertex with the worst slack.
-  // When nullptr the worst slack is unknown but in the queue.
-  Vertex *worst_vertex_{nullptr};
-  Slack worst_slack_;
-  Slack slack_threshold_;
-  // Vertices with slack < threshold_
-  VertexSet *queue_;
-  // Queue is sorted and pruned to min_queue_size_ vertices when it
-  // reaches max_queue_size_.
-  size_t min_queue_size_{10};
-  size_t max_queue_size_{20};
+  // Endpoints ordered by slack, worst first.
+  EndpointSlackSet slacks_;
+  // Slack of each endpoint in slacks_.
+  VertexSlackMap vertex_slacks_;
+  // Sum of the negative slacks in slacks_.
+  DelayDbl tns_{0.0};
+  // Locking is required because paths are deleted by ArrivalVisitor
+  // on multiple threads.
   std::mutex lock_;
 };
 
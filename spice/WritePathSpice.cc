@@ -578,6 +578,9 @@ WritePathSpice::writeStageParasitics(Stage stage)
   }
   NetSet coupling_nets;
   writeDrvrParasitics(drvr_pin, parasitic, coupling_nets);
+  // Lazily read networks are deleted when they are not needed.
+  parasitics_->releaseParasiticNetwork(drvr_pin);
+  parasitics_->reportNetworkReadMessages();
 }
 
 ////////////////////////////////////////////////////////////////
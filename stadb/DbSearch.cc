@@ -408,7 +408,7 @@ DbSearchWriter::writeVertexPaths(DbWriter &paths)
         paths.putF32(delayAsFloat(path->arrival()));
         paths.putF32(delayAsFloat(path->required()));
         paths.putBool(path->isEnum());
-        Path *prev = path->prevPath();
+        Path *prev = path->prevPath(sta_);
         paths.putBool(prev != nullptr);
         if (prev) {
           paths.putU32(vertexIndex(prev->vertex(sta_)));
@@ -865,7 +865,7 @@ DbSearchReader::linkPrevPaths()
                                   "search previous timing arc");
     // Order matters: the previous edge id shares storage with the vertex id,
     // and which one is live is decided by the previous path being set.
-    path->setPrevPath(prev);
+    path->setPrevPath(prev, sta_);
     path->setPrevEdgeArc(prev_edge, prev_arc, sta_);
   }
 }
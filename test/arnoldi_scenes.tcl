@@ -0,0 +1,71 @@
+# Arnoldi delays with scenes that find their parasitics together.
+source helpers.tcl
+read_liberty ../examples/asap7_small_ff.lib.gz
+read_liberty ../examples/asap7_small_ss.lib.gz
+read_verilog ../examples/reg1_asap7.v
+link_design top
+
+read_sdc -mode mode1 ../examples/mcmm2_mode1.sdc
+read_sdc -mode mode2 ../examples/mcmm2_mode2.sdc
+
+read_spef -name reg1_ff ../examples/reg1_asap7.spef
+read_spef -name reg1_ss ../examples/reg1_asap7_ss.spef
+
+# scene3 is the same as scene1.
+define_scene scene1 -mode mode1 -liberty asap7_small_ff -spef reg1_ff
+define_scene scene2 -mode mode2 -liberty asap7_small_ss -spef reg1_ss
+define_scene scene3 -mode mode1 -liberty asap7_small_ff -spef reg1_ff
+sta::set_delay_calculator arnoldi
+
+proc report_scene { scene } {
+  with_output_to_variable rpt {
+    report_checks -scenes $scene -path_delay min_max -fields {slew cap}
+    report_dcalc -scene $scene -from u1/A -to u1/Y
+    report_dcalc -scene $scene -from u2/B -to u2/Y
+  }
+  regsub -all {\mscene[0-9]\M} $rpt "scene" rpt
+  return $rpt
+}
+
+set rpt1 [report_scene scene1]
+set rpt2 [report_scene scene2]
+set rpt3 [report_scene scene3]
+compare_rpts "same scenes" $rpt1 $rpt3
+if { $rpt1 != $rpt2 } {
+  puts "different scenes differ"
+} else {
+  puts "different scenes match"
+}
+
+# The delays found for all analysis points of a driver together match
+# the delays found one analysis point at a time.
+proc edge_delays { from to } {
+  set delays {}
+  foreach edge [get_timing_edges -from $from -to $to] {
+    foreach arc [$edge timing_arcs] {
+      lappend delays [$edge arc_delay_strings $arc 0 4]
+    }
+  }
+  return $delays
+}
+
+proc find_ap_delays { from to } {
+  foreach edge [get_timing_edges -from $from -to $to] {
+    foreach arc [$edge timing_arcs] {
+      foreach scene_name {scene1 scene2 scene3} {
+        set scene [sta::find_scene $scene_name]
+        foreach min_max {min max} {
+          sta::find_arc_delays $edge $arc $scene $min_max
+        }
+      }
+    }
+  }
+}
+
+foreach arc_pins {{u1/A u1/Y} {u2/B u2/Y} {r1/CLK r1/Q}} {
+  lassign $arc_pins from to
+  set ap_delays [edge_delays $from $to]
+  find_ap_delays $from $to
+  compare_rpts "$from $to analysis point delays" $ap_delays \
+    [edge_delays $from $to]
+}
@@ -0,0 +1,71 @@
+# compact_graph rebuilds the same vertices, edges and timing.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc graph_edges { } {
+  set edges {}
+  set vertex_iter [sta::vertex_iterator]
+  while { [$vertex_iter has_next] } {
+    set vertex [$vertex_iter next]
+    set edge_iter [$vertex out_edge_iterator]
+    while { [$edge_iter has_next] } {
+      set edge [$edge_iter next]
+      lappend edges [$edge to_string]
+    }
+    $edge_iter finish
+  }
+  $vertex_iter finish
+  return [lsort $edges]
+}
+
+proc vertex_count { } {
+  set count 0
+  set vertex_iter [sta::vertex_iterator]
+  while { [$vertex_iter has_next] } {
+    $vertex_iter next
+    incr count
+  }
+  $vertex_iter finish
+  return $count
+}
+
+with_output_to_variable checks1 { report_checks -path_delay min_max }
+set vertex_count1 [vertex_count]
+set edges1 [graph_edges]
+
+compact_graph
+
+with_output_to_variable checks2 { report_checks -path_delay min_max }
+compare_rpts "vertex counts" $vertex_count1 [vertex_count]
+set edges2 [graph_edges]
+compare_rpts "edge counts" [llength $edges1] [llength $edges2]
+compare_rpts "edges" $edges1 $edges2
+compare_rpts "report_checks" $checks1 $checks2
+
+# Annotated delays and slews are kept.
+read_liberty ../examples/nangate45_slow.lib.gz
+read_verilog ../examples/example1.v
+link_design top
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+read_sdf ../examples/example1.sdf
+set_assigned_delay -cell -from u1/A -to u1/Z 0.2
+set_assigned_check -setup -from r3/CK -to r3/D 0.3
+set_assigned_transition 0.15 [get_pins u2/A1]
+
+proc report_annotated { } {
+  with_output_to_variable rpt {
+    report_checks -fields {slew}
+    report_annotated_delay -report_annotated
+    report_annotated_check -report_annotated
+  }
+  return $rpt
+}
+
+set annotated1 [report_annotated]
+compact_graph
+compare_rpts "annotations" $annotated1 [report_annotated]
@@ -0,0 +1,57 @@
+# sta_concurrent_modes reports the same timing as serial mode preparation.
+source helpers.tcl
+read_liberty ../examples/asap7_small_ff.lib.gz
+read_liberty ../examples/asap7_small_ss.lib.gz
+read_verilog ../examples/reg1_asap7.v
+link_design top
+
+read_sdc -mode mode1 ../examples/mcmm2_mode1.sdc
+read_sdc -mode mode2 ../examples/mcmm2_mode2.sdc
+
+read_spef -name reg1_ff ../examples/reg1_asap7.spef
+read_spef -name reg1_ss ../examples/reg1_asap7_ss.spef
+
+define_scene scene1 -mode mode1 -liberty asap7_small_ff -spef reg1_ff
+define_scene scene2 -mode mode2 -liberty asap7_small_ss -spef reg1_ss
+sta::set_thread_count 4
+
+# Constants on the same instance in both modes set the sim flags of
+# the shared vertices and edges concurrently.
+proc set_mode_constants { } {
+  set_mode mode1
+  set_case_analysis 1 [get_pins u2/B]
+  set_mode mode2
+  set_case_analysis 1 [get_pins u2/A]
+}
+
+proc unset_mode_constants { } {
+  set_mode mode1
+  unset_case_analysis [get_pins u2/B]
+  set_mode mode2
+  unset_case_analysis [get_pins u2/A]
+}
+
+proc report_modes { } {
+  with_output_to_variable rpt {
+    report_checks -scenes scene1 -path_delay min_max
+    report_checks -scenes scene2 -path_delay min_max
+    report_checks -group_path_count 4
+    set_mode mode1
+    report_disabled_edges
+    set_mode mode2
+    report_disabled_edges
+  }
+  return $rpt
+}
+
+set sta_concurrent_modes 1
+set_mode_constants
+set concurrent_rpt [report_modes]
+unset_mode_constants
+set concurrent_unset_rpt [report_modes]
+
+set sta_concurrent_modes 0
+set_mode_constants
+compare_rpts "constants" $concurrent_rpt [report_modes]
+unset_mode_constants
+compare_rpts "no constants" $concurrent_unset_rpt [report_modes]
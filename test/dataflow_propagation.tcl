@@ -0,0 +1,52 @@
+# sta_dataflow_propagation delays and arrivals match level by level visits.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+set_propagated_clock clk
+read_spef ../examples/gcd_sky130hd.spef
+sta::set_thread_count 4
+
+proc report_timing_rpt { } {
+  with_output_to_variable rpt {
+    report_checks -path_delay min_max -group_path_count 20 -fields {slew cap}
+    report_tns
+    report_wns
+  }
+  return $rpt
+}
+
+# Time incrementally with dataflow visits and compare to a full update
+# with level by level visits.
+proc compare_incremental { what } {
+  global sta_dataflow_propagation
+  set dataflow_rpt [report_timing_rpt]
+  set sta_dataflow_propagation 0
+  sta::delays_invalid
+  compare_rpts $what [report_timing_rpt] $dataflow_rpt
+  set sta_dataflow_propagation 1
+}
+
+set level_rpt [report_timing_rpt]
+
+set sta_dataflow_propagation 1
+sta::delays_invalid
+compare_rpts "dataflow full update" $level_rpt [report_timing_rpt]
+
+# Incremental delays with a small fanout.
+set_load 0.02 [get_ports resp_msg*]
+compare_incremental "dataflow incremental load"
+
+# Incremental delays with the fanout of the inputs.
+set_input_transition 0.3 [get_ports req_msg*]
+compare_incremental "dataflow incremental slew"
+
+# Incremental arrivals.
+set_input_delay 2 -clock clk [get_ports req_msg*]
+compare_incremental "dataflow incremental arrival"
+
+# Repeated full updates reuse the dataflow fanin counts.
+set dataflow_rpt [report_timing_rpt]
+sta::delays_invalid
+compare_rpts "dataflow repeated update" [report_timing_rpt] $dataflow_rpt
@@ -39,3 +39,20 @@ proc make_result_file { filename } {
 proc sort_objects { objects } {
   return [sta::sort_by_full_name $objects]
 }
+
+# Compare the reports of two runs that should match.
+proc compare_rpts { what rpt1 rpt2 } {
+  if { $rpt1 == $rpt2 } {
+    puts "$what match"
+  } else {
+    puts "$what differ"
+  }
+}
+
+proc report_result { what ok } {
+  if { $ok } {
+    puts "$what ok"
+  } else {
+    puts "$what failed"
+  }
+}
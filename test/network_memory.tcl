@@ -0,0 +1,57 @@
+# report_network_memory redirection and object counts
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+
+set memory_file [make_result_file network_memory.log]
+report_network_memory > $memory_file
+set stream [open $memory_file r]
+set memory [read $stream]
+close $stream
+
+regexp -line {^ instances +([0-9]+) } $memory ignore inst_count
+regexp -line {^ nets +([0-9]+) } $memory ignore net_count
+# The top instance is included in the instance count.
+if { $inst_count == [llength [get_cells *]] + 1 } {
+  puts "instance count match"
+} else {
+  puts "instance count mismatch $inst_count"
+}
+if { $net_count == [llength [get_nets *]] } {
+  puts "net count match"
+} else {
+  puts "net count mismatch $net_count"
+}
+
+# ECO create/delete loops reuse the memory of deleted names and objects.
+proc eco_loop { count } {
+  for { set i 0 } { $i < $count } { incr i } {
+    make_instance eco_inst$i sky130_fd_sc_hd__buf_1
+    make_net eco_net$i
+    connect_pin eco_net$i eco_inst$i/A
+    delete_instance eco_inst$i
+    delete_net eco_net$i
+  }
+}
+
+# Name count and allocated MB of each pool.
+proc pool_memory {} {
+  set memory_file [make_result_file network_memory.log]
+  report_network_memory > $memory_file
+  set stream [open $memory_file r]
+  set memory [read $stream]
+  close $stream
+  set pools {}
+  foreach pool {instances nets pins names} {
+    regexp -line "^ $pool +(\[0-9\]+) .* allocated +(\[0-9.\]+)MB" \
+      $memory ignore count allocated
+    lappend pools $pool $count $allocated
+  }
+  return $pools
+}
+
+eco_loop 1
+set memory_before [pool_memory]
+eco_loop 20000
+report_result "eco memory bounded" [expr {[pool_memory] == $memory_before}]
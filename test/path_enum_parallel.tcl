@@ -0,0 +1,31 @@
+# Parallel path enumeration reports the same paths as one thread.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc path_enum_rpts { } {
+  with_output_to_variable paths {
+    report_checks -path_delay min_max -group_path_count 40 \
+      -endpoint_path_count 8
+  }
+  with_output_to_variable ends {
+    report_checks -path_delay min_max -group_path_count 500 \
+      -endpoint_path_count 50 -format end
+  }
+  with_output_to_variable unique_edges {
+    report_checks -group_path_count 200 -endpoint_path_count 20 \
+      -unique_edges_to_endpoint -format end
+  }
+  return [list $paths $ends $unique_edges]
+}
+
+sta::set_thread_count 1
+lassign [path_enum_rpts] paths1 ends1 unique_edges1
+sta::set_thread_count 4
+lassign [path_enum_rpts] paths4 ends4 unique_edges4
+compare_rpts "group paths" $paths1 $paths4
+compare_rpts "group path ends" $ends1 $ends4
+compare_rpts "unique edge path ends" $unique_edges1 $unique_edges4
@@ -0,0 +1,43 @@
+# Paths link to previous vertex paths by index and to previous
+# path copies by pointer for generated clock source paths and path
+# enumeration.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+create_generated_clock -name gclk -source [get_ports clk] -divide_by 1 \
+  [get_pins clkbuf_2_0__f_clk/X]
+set_propagated_clock [all_clocks]
+# Check that previous paths are in the vertex path arrays.
+sta::set_debug path 1
+
+proc report_paths { } {
+  with_output_to_variable rpt {
+    report_checks -path_delay min_max -group_path_count 10 \
+      -endpoint_path_count 3 -format full_clock_expanded
+  }
+  return $rpt
+}
+
+set rpt1 [report_paths]
+# The generated clock source latency is reported through the path
+# copies of its source path.
+with_output_to_variable gclk_rpt {
+  report_checks -to [get_clocks gclk] -format full_clock_expanded
+}
+report_result "gclk source path" \
+  [expr { [string first "clkbuf_0_clk/X" $gclk_rpt] != -1 }]
+sta::arrivals_invalid
+report_result "repeated report" [expr { [report_paths] == $rpt1 }]
+
+# Reported paths follow the previous path indices of the min and max
+# vertex paths.
+read_liberty -max ../examples/nangate45_slow.lib.gz
+read_liberty -min ../examples/nangate45_fast.lib.gz
+read_verilog ../examples/example1.v
+link_design top
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+report_checks -path_delay min_max
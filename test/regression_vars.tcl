@@ -141,9 +141,13 @@ record_example_tests {
 }
 
 record_public_tests {
+  arnoldi_scenes
   case_insensitive_matching
   collections
+  compact_graph
+  concurrent_modes
   constraint_modes
+  dataflow_propagation
   delay_calc_no_inv
   disable_clock_gating_check
   disconnect_mcp_pin
@@ -181,12 +185,15 @@ record_public_tests {
   liberty_write_escaped_names
   make_concrete_parasitics_leak
   max_power_area
+  network_memory
   non_seq_timing
   package_require
   path_dedup_same_delay
   path_dedup_silimate
   path_dedup_worst
+  path_enum_parallel
   path_group_names
+  path_prev_index
   pin_name_compatibility
   pin_props
   power_calc_no_inv
@@ -200,6 +207,7 @@ record_public_tests {
   report_checks_src_attr
   report_json1
   report_json2
+  required_tolerance
   sdc_compat
   sdc_strip_escaped_bus
   set_path_margin1
@@ -208,7 +216,10 @@ record_public_tests {
   set_path_margin4
   set_path_margin5
   set_path_margin6
+  slack_histogram
   slash_port_test
+  spef_lazy
+  spef_parallel
   stadb
   stadb_cmds
   stadb_errors
@@ -224,6 +235,7 @@ record_public_tests {
   suppress_msg
   swig_seq_double_free
   swig_seq_leak
+  table_pool
   user_properties
   vcd_begin_end_time
   vcd_timestamp
@@ -0,0 +1,77 @@
+# set_incremental_required_tolerance prunes small required time changes.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc required_updates { } {
+  with_output_to_variable rpt { report_required_updates }
+  set counts {}
+  foreach line [split [string trim $rpt] "\n"] {
+    lappend counts [lindex $line 2]
+  }
+  return $counts
+}
+
+proc pin_slacks { } {
+  set slacks {}
+  foreach pin [get_pins -hierarchical *] {
+    lappend slacks [get_property $pin slack_max]
+  }
+  return $slacks
+}
+
+proc max_slack_diff { slacks1 slacks2 } {
+  set max_diff 0.0
+  foreach slack1 $slacks1 slack2 $slacks2 {
+    if { [string is double $slack1] && [string is double $slack2] } {
+      set max_diff [expr max($max_diff, abs($slack1 - $slack2))]
+    }
+  }
+  return $max_diff
+}
+
+set loads {0.001 0.002 0.003 0.004 0.005}
+sta::find_requireds
+
+# Every change is propagated with the default tolerance.
+set exact_ok 1
+foreach load $loads {
+  set_load $load [get_ports resp_msg*]
+  sta::find_requireds
+  lassign [required_updates] changed pruned
+  if { !($changed > 0 && $pruned == 0) } {
+    set exact_ok 0
+  }
+}
+report_result "exact" $exact_ok
+set exact_slacks [pin_slacks]
+
+# Small changes are pruned and are compared against the required
+# times that were last propagated so they do not accumulate.
+set_load 0.0 [get_ports resp_msg*]
+sta::find_requireds
+set tolerance 0.02
+set_incremental_required_tolerance $tolerance
+set total_pruned 0
+foreach load $loads {
+  set_load $load [get_ports resp_msg*]
+  sta::find_requireds
+  lassign [required_updates] changed pruned
+  incr total_pruned $pruned
+}
+report_result "pruned" [expr { $total_pruned > 0 }]
+set pruned_slacks [pin_slacks]
+# Slack properties have 6 digits.
+report_result "pruned slacks" \
+  [expr { [max_slack_diff $exact_slacks $pruned_slacks] <= $tolerance + 1e-6 }]
+
+# Report output can be redirected.
+set rpt_file [make_result_file required_tolerance.log]
+report_required_updates > $rpt_file
+set stream [open $rpt_file r]
+set rpt [read $stream]
+close $stream
+report_result "redirect" [expr { [llength [split [string trim $rpt] "\n"]] == 2 }]
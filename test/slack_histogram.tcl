@@ -0,0 +1,78 @@
+# report_worst_slack_endpoints and report_slack_histogram agree with
+# report_worst_slack and with each other.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+read_spef ../examples/gcd_sky130hd.spef
+
+proc worst_endpoint_slacks { min_max count } {
+  with_output_to_variable rpt {
+    report_worst_slack_endpoints -$min_max -count $count
+  }
+  set slacks {}
+  foreach line [split [string trim $rpt] "\n"] {
+    lappend slacks [lindex $line 0]
+  }
+  return $slacks
+}
+
+proc histogram_counts { min_max bin_maxes } {
+  with_output_to_variable rpt {
+    report_slack_histogram -$min_max $bin_maxes
+  }
+  set counts {}
+  foreach line [split [string trim $rpt] "\n"] {
+    lappend counts [lindex $line 2]
+  }
+  return $counts
+}
+
+proc check_slacks { min_max } {
+  with_output_to_variable rpt { report_worst_slack -$min_max }
+  set worst_slack [lindex $rpt 3]
+  set all_slacks [worst_endpoint_slacks $min_max 100000]
+  set endpoint_count [llength $all_slacks]
+  set worst5 [worst_endpoint_slacks $min_max 5]
+
+  set ok [expr { $endpoint_count > 5
+                 && [lindex $worst5 0] == $worst_slack
+                 && $worst5 == [lrange $all_slacks 0 4] }]
+  set prev_slack [lindex $all_slacks 0]
+  foreach slack $all_slacks {
+    if { $slack < $prev_slack } {
+      set ok 0
+    }
+    set prev_slack $slack
+  }
+  report_result "$min_max worst endpoints" $ok
+
+  # Bins below the worst slack, up to the worst slack, up to the median
+  # slack and past every slack. The reported slacks are rounded.
+  set median [lindex $all_slacks [expr $endpoint_count / 2]]
+  set counts [histogram_counts $min_max \
+                [list 1e6 [expr $median + 0.001] \
+                   [expr $worst_slack + 0.001] [expr $worst_slack - 1.0]]]
+  lassign $counts below worst to_median rest
+  set ok [expr { $below == 0 && $worst >= 1
+                 && $worst + $to_median > $endpoint_count / 2
+                 && $worst + $to_median + $rest == $endpoint_count }]
+  report_result "$min_max histogram" $ok
+}
+
+check_slacks max
+check_slacks min
+# Incremental update.
+set_load 0.05 [get_ports resp_msg*]
+check_slacks max
+
+# Endpoints r1/D and r2/D have almost the whole clock period of slack.
+read_liberty ../examples/nangate45_slow.lib.gz
+read_verilog ../examples/example1.v
+link_design top
+read_spef ../examples/example1.dspef
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+report_worst_slack_endpoints -max -count 1
+report_slack_histogram -max {1 2 100}
@@ -0,0 +1,61 @@
+# read_spef -lazy reports the same timing as reading every network.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+
+proc spef_rpts { } {
+  with_output_to_variable annotation {
+    report_parasitic_annotation -report_unannotated
+  }
+  with_output_to_variable checks {
+    report_checks -path_delay min_max -group_path_count 20 -format end
+  }
+  return [list $annotation $checks]
+}
+
+set spef_file ../examples/gcd_sky130hd.spef
+read_spef $spef_file
+lassign [spef_rpts] annotation checks
+
+read_spef -lazy $spef_file
+lassign [spef_rpts] annotation_lazy checks_lazy
+compare_rpts "lazy annotation" $annotation $annotation_lazy
+compare_rpts "lazy checks" $checks $checks_lazy
+
+sta::set_thread_count 4
+read_spef -lazy $spef_file
+lassign [spef_rpts] annotation_lazy4 checks_lazy4
+compare_rpts "parallel lazy annotation" $annotation $annotation_lazy4
+compare_rpts "parallel lazy checks" $checks $checks_lazy4
+
+# Lazy networks are only held while delay calculation and
+# report_parasitic_annotation use them.
+read_spef -lazy $spef_file
+report_result "lazy networks unread" [expr [sta::parasitic_network_count] == 0]
+spef_rpts
+report_result "lazy networks released" [expr [sta::parasitic_network_count] == 0]
+
+# Disconnecting a pin edits the lazy network of its net. The edited
+# network is kept and the other networks are read again.
+set eco_net _186_
+set eco_pin [lindex [get_pins -of_objects [get_nets $eco_net] \
+                       -filter "direction == input"] 0]
+proc eco_rpts { } {
+  global eco_net eco_pin
+  disconnect_pin $eco_net $eco_pin
+  connect_pin $eco_net $eco_pin
+  return [spef_rpts]
+}
+
+read_spef $spef_file
+spef_rpts
+lassign [eco_rpts] annotation_eco checks_eco
+
+read_spef -lazy $spef_file
+spef_rpts
+lassign [eco_rpts] annotation_lazy_eco checks_lazy_eco
+compare_rpts "lazy eco annotation" $annotation_eco $annotation_lazy_eco
+compare_rpts "lazy eco checks" $checks_eco $checks_lazy_eco
+report_result "lazy eco network kept" [expr [sta::parasitic_network_count] == 1]
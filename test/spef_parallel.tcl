@@ -0,0 +1,53 @@
+# Parallel and gzip spef reads annotate the same parasitics as a
+# serial read.
+source helpers.tcl
+read_liberty ../examples/sky130hd_tt.lib.gz
+read_verilog ../examples/gcd_sky130hd.v
+link_design gcd
+read_sdc ../examples/gcd_sky130hd.sdc
+
+proc spef_rpts { } {
+  with_output_to_variable annotation {
+    report_parasitic_annotation -report_unannotated
+  }
+  with_output_to_variable checks {
+    report_checks -path_delay min_max -group_path_count 20 -format end
+  }
+  return [list $annotation $checks]
+}
+
+set spef_file ../examples/gcd_sky130hd.spef
+sta::set_thread_count 1
+read_spef $spef_file
+lassign [spef_rpts] annotation1 checks1
+
+sta::set_thread_count 4
+read_spef $spef_file
+lassign [spef_rpts] annotation4 checks4
+compare_rpts "parallel annotation" $annotation1 $annotation4
+compare_rpts "parallel checks" $checks1 $checks4
+
+set stream [open $spef_file r]
+set spef [read $stream]
+close $stream
+set gz_file [make_result_file gcd_sky130hd.spef.gz]
+set stream [open $gz_file wb]
+puts -nonewline $stream [zlib gzip $spef]
+close $stream
+read_spef $gz_file
+lassign [spef_rpts] annotation_gz checks_gz
+compare_rpts "gzip annotation" $annotation1 $annotation_gz
+compare_rpts "gzip checks" $checks1 $checks_gz
+
+# Pad the cap and res lines with comments so the gzip file inflates to
+# more than the 1MB window and the scanner refills it in the middle of
+# the nets.
+regsub -all -line {^[0-9].*$} $spef "& // [string repeat - 300]" spef_padded
+report_result "gzip padding" [expr [string length $spef_padded] > 2 * 1024 * 1024]
+set stream [open $gz_file wb]
+puts -nonewline $stream [zlib gzip $spef_padded]
+close $stream
+read_spef $gz_file
+lassign [spef_rpts] annotation_gz checks_gz
+compare_rpts "gzip window annotation" $annotation1 $annotation_gz
+compare_rpts "gzip window checks" $checks1 $checks_gz
@@ -0,0 +1,18 @@
+# Liberty tables shared between libraries by the table pool
+source helpers.tcl
+read_liberty ../examples/nangate45_slow.lib.gz
+set table_count [sta::table_pool_table_count]
+set axis_count [sta::table_pool_axis_count]
+report_result "table pool" [expr $table_count > 0 && $axis_count > 0]
+
+# A second library with the same tables adds nothing to the pool.
+read_liberty ../examples/nangate45_slow.lib.gz
+report_result "table dedup" \
+  [expr [sta::table_pool_table_count] == $table_count \
+     && [sta::table_pool_axis_count] == $axis_count]
+
+# Tables are removed from the pool with the last library using them.
+sta::clear_network
+report_result "table erasure" \
+  [expr [sta::table_pool_table_count] == 0 \
+     && [sta::table_pool_axis_count] == 0]
@@ -7,6 +7,9 @@
 
 #include "DispatchQueue.hh"
 
+#include <algorithm>
+#include <memory>
+
 namespace sta {
 
 DispatchQueue::DispatchQueue(size_t thread_count) :
@@ -88,6 +91,133 @@ DispatchQueue::dispatch(fp_t&& op)
   cv_.notify_one();
 }
 
+// Slice of a parallelFor index range. Chunks are claimed from the
+// front of the slice by the owning task and by stealing tasks alike,
+// so a single atomic cursor is all that is needed.
+class alignas(64) StealRange
+{
+public:
+  bool claim(size_t grain_size,
+             // Return values.
+             size_t &begin,
+             size_t &end);
+
+  std::atomic<size_t> next_{0};
+  size_t end_{0};
+};
+
+bool
+StealRange::claim(size_t grain_size,
+                  // Return values.
+                  size_t &begin,
+                  size_t &end)
+{
+  // Avoid bumping the cursor of exhausted slices.
+  if (next_.load(std::memory_order_relaxed) >= end_)
+    return false;
+  begin = next_.fetch_add(grain_size, std::memory_order_relaxed);
+  if (begin >= end_)
+    return false;
+  end = std::min(begin + grain_size, end_);
+  return true;
+}
+
+// State shared by the tasks of one parallelFor. Queued tasks that the
+// caller ran itself reference it after parallelFor returns, so it is
+// held by a shared_ptr instead of living on the caller's stack.
+class ParallelForTasks
+{
+public:
+  ParallelForTasks(size_t count,
+                   size_t task_count,
+                   size_t grain_size,
+                   const DispatchQueue::RangeFn &op);
+  // Run task k unless another thread has already started it.
+  void run(size_t k);
+  void wait() { finished_.wait(); }
+  size_t stealCount() const { return steal_count_.load(std::memory_order_relaxed); }
+
+private:
+  size_t task_count_;
+  size_t grain_size_;
+  std::vector<StealRange> ranges_;
+  std::unique_ptr<std::atomic<bool>[]> started_;
+  // Counts down when each task finishes.
+  DynamicLatch finished_;
+  std::atomic<size_t> steal_count_{0};
+  // Only called by tasks that run before parallelFor returns.
+  const DispatchQueue::RangeFn &op_;
+};
+
+ParallelForTasks::ParallelForTasks(size_t count,
+                                   size_t task_count,
+                                   size_t grain_size,
+                                   const DispatchQueue::RangeFn &op) :
+  task_count_(task_count),
+  grain_size_(grain_size),
+  ranges_(task_count),
+  started_(new std::atomic<bool>[task_count]),
+  finished_(task_count),
+  op_(op)
+{
+  size_t slice_size = count / task_count;
+  size_t from = 0;
+  for (size_t k = 0; k < task_count; k++) {
+    // Last task gets the left overs.
+    size_t to = (k == task_count - 1) ? count : from + slice_size;
+    ranges_[k].next_ = from;
+    ranges_[k].end_ = to;
+    started_[k] = false;
+    from = to;
+  }
+}
+
+void
+ParallelForTasks::run(size_t k)
+{
+  if (started_[k].exchange(true, std::memory_order_acq_rel))
+    return;
+  size_t begin, end;
+  while (ranges_[k].claim(grain_size_, begin, end))
+    op_(k, begin, end);
+  size_t steals = 0;
+  for (size_t i = 1; i < task_count_; i++) {
+    StealRange &victim = ranges_[(k + i) % task_count_];
+    while (victim.claim(grain_size_, begin, end)) {
+      op_(k, begin, end);
+      steals++;
+    }
+  }
+  if (steals)
+    steal_count_.fetch_add(steals, std::memory_order_relaxed);
+  finished_.countDown();
+}
+
+size_t
+DispatchQueue::parallelFor(size_t count,
+                           size_t task_count,
+                           size_t grain_size,
+                           const RangeFn &op)
+{
+  if (count == 0)
+    return 0;
+  task_count = std::clamp(task_count, size_t(1), count);
+  grain_size = std::max(grain_size, size_t(1));
+  auto tasks = std::make_shared<ParallelForTasks>(count, task_count,
+                                                  grain_size, op);
+  for (size_t k = 1; k < task_count; k++)
+    dispatch([tasks, k](int) { tasks->run(k); });
+  // The caller runs the tasks that no thread has started instead of
+  // waiting for the queue to drain, so a parallelFor called from a
+  // task on a worker thread cannot wait on tasks that only the
+  // blocked workers would run.
+  for (size_t k = 0; k < task_count; k++)
+    tasks->run(k);
+  // The other tasks are running on worker threads.
+  tasks->wait();
+  return tasks->stealCount();
+}
+
 void
 DispatchQueue::dispatch_thread_handler(size_t i)
 {
@@ -0,0 +1,208 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "FileBuffer.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "Zlib.hh"
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace sta {
+
+static constexpr size_t block_size = 1 << 20;
+
+FileBuffer::~FileBuffer()
+{
+  clear();
+}
+
+void
+FileBuffer::clear()
+{
+#if !defined(_WIN32)
+  if (mapped_)
+    munmap(mapped_, mapped_size_);
+#endif
+  mapped_ = nullptr;
+  mapped_size_ = 0;
+  data_.clear();
+  data_.shrink_to_fit();
+  compressed_ = false;
+}
+
+std::string_view
+FileBuffer::contents() const
+{
+  if (mapped_)
+    return std::string_view(mapped_, mapped_size_);
+  else
+    return data_;
+}
+
+bool
+FileBuffer::read(std::string_view filename)
+{
+  clear();
+  std::string filename1(filename);
+  std::ifstream stream(filename1, std::ios::binary);
+  if (!stream.is_open())
+    return false;
+  // Sniff the gzip magic number.
+  char magic[2] = {0, 0};
+  stream.read(magic, 2);
+  stream.close();
+  compressed_ = static_cast<unsigned char>(magic[0]) == 0x1f
+    && static_cast<unsigned char>(magic[1]) == 0x8b;
+  if (compressed_)
+    return true;
+  else
+    return readMapped(filename1);
+}
+
+bool
+FileBuffer::readMapped(const std::string &filename)
+{
+#if !defined(_WIN32)
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0
+      || !S_ISREG(file_stat.st_mode)) {
+    close(fd);
+    return readStream(filename);
+  }
+  size_t size = file_stat.st_size;
+  if (size == 0) {
+    close(fd);
+    return true;
+  }
+  void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping holds its own reference to the file.
+  close(fd);
+  if (mapped == MAP_FAILED)
+    return readStream(filename);
+  madvise(mapped, size, MADV_SEQUENTIAL);
+  mapped_ = static_cast<char *>(mapped);
+  mapped_size_ = size;
+  return true;
+#else
+  return readStream(filename);
+#endif
+}
+
+bool
+FileBuffer::readStream(const std::string &filename)
+{
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+  if (!stream.is_open())
+    return false;
+  std::streamoff size = stream.tellg();
+  if (size > 0) {
+    data_.resize(size);
+    stream.seekg(0);
+    stream.read(data_.data(), size);
+    data_.resize(stream.gcount());
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////
+
+CompressedFileWindow::~CompressedFileWindow()
+{
+#ifdef ZLIB_FOUND
+  if (file_)
+    gzclose(static_cast<gzFile>(file_));
+#endif
+}
+
+bool
+CompressedFileWindow::isSupported()
+{
+#ifdef ZLIB_FOUND
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool
+CompressedFileWindow::open(std::string_view filename)
+{
+#ifdef ZLIB_FOUND
+  gzFile file = gzopen(std::string(filename).c_str(), "rb");
+  if (file == Z_NULL)
+    return false;
+  gzbuffer(file, block_size);
+  file_ = file;
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::string_view
+CompressedFileWindow::refill(const char *keep)
+{
+  size_t keep_begin = keep ? keep - buffer_.data() : window_end_;
+  // Move the kept text and the partial line after the window to the
+  // front of the buffer.
+  size_ -= keep_begin;
+  std::memmove(buffer_.data(), buffer_.data() + keep_begin, size_);
+  window_end_ = size_;
+#ifdef ZLIB_FOUND
+  while (!eof_) {
+    if (size_ == buffer_.size())
+      buffer_.resize(std::max(buffer_.size() * 2, block_size));
+    int count = gzread(static_cast<gzFile>(file_), buffer_.data() + size_,
+                       static_cast<unsigned>(buffer_.size() - size_));
+    if (count <= 0) {
+      eof_ = true;
+      read_error_ = count < 0;
+      break;
+    }
+    std::string_view inflated(buffer_.data() + size_, count);
+    size_ += count;
+    size_t eol = inflated.rfind('\n');
+    if (eol != std::string_view::npos) {
+      window_end_ = inflated.data() + eol + 1 - buffer_.data();
+      return std::string_view(buffer_.data(), window_end_);
+    }
+  }
+#endif
+  window_end_ = size_;
+  return std::string_view(buffer_.data(), window_end_);
+}
+
+} // namespace sta
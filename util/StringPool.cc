@@ -0,0 +1,237 @@
+// OpenSTA, Static Timing Analyzer
+// Copyright (c) 2026, Parallax Software, Inc.
+// 
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// 
+// The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.
+// 
+// Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+// 
+// This notice may not be removed or altered from any source distribution.
+
+#include "StringPool.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Hash.hh"
+
+namespace sta {
+
+const char *
+StringPool::intern(std::string_view str)
+{
+  // Keep the load factor at most 1/2.
+  if ((size_ + 1) * 2 > slots_.size())
+    grow();
+  size_t mask = slots_.size() - 1;
+  for (size_t i = slotIndex(str); ; i = (i + 1) & mask) {
+    std::string_view &slot = slots_[i];
+    if (slot.data() == nullptr) {
+      const char *pooled = copy(str);
+      slot = std::string_view(pooled, str.size());
+      size_++;
+      return pooled;
+    }
+    if (slot == str) {
+      const char *pooled = slot.data();
+      setRefCount(pooled, refCount(pooled) + 1);
+      return pooled;
+    }
+  }
+}
+
+void
+StringPool::release(const char *pooled)
+{
+  RefCount ref_count = refCount(pooled) - 1;
+  if (ref_count > 0)
+    setRefCount(pooled, ref_count);
+  else {
+    eraseSlot(pooled);
+    size_--;
+    size_t count = copyBytes(length(pooled));
+    char_bytes_ -= count;
+    char *chars = const_cast<char*>(pooled) - header_size_;
+    size_t free_index = count / copy_align_;
+    if (free_index >= free_lists_.size())
+      free_lists_.resize(free_index + 1, nullptr);
+    std::memcpy(chars, &free_lists_[free_index], sizeof(char*));
+    free_lists_[free_index] = chars;
+  }
+}
+
+const char *
+StringPool::find(std::string_view str) const
+{
+  if (slots_.empty())
+    return nullptr;
+  size_t mask = slots_.size() - 1;
+  for (size_t i = slotIndex(str); ; i = (i + 1) & mask) {
+    const std::string_view &slot = slots_[i];
+    if (slot.data() == nullptr)
+      return nullptr;
+    if (slot == str)
+      return slot.data();
+  }
+}
+
+size_t
+StringPool::length(const char *pooled)
+{
+  Length length;
+  std::memcpy(&length, pooled - sizeof(Length), sizeof(Length));
+  return length;
+}
+
+std::string_view
+StringPool::view(const char *pooled)
+{
+  return std::string_view(pooled, length(pooled));
+}
+
+StringPool::RefCount
+StringPool::refCount(const char *pooled)
+{
+  RefCount ref_count;
+  std::memcpy(&ref_count, pooled - header_size_, sizeof(RefCount));
+  return ref_count;
+}
+
+void
+StringPool::setRefCount(const char *pooled,
+                        RefCount ref_count)
+{
+  char *chars = const_cast<char*>(pooled) - header_size_;
+  std::memcpy(chars, &ref_count, sizeof(RefCount));
+}
+
+// Fibonacci hashing spreads the string hash over the slot index bits.
+size_t
+StringPool::slotIndex(std::string_view str) const
+{
+  return (hashString(str) * 11400714819323198485ull) >> (64 - slot_bits_);
+}
+
+void
+StringPool::grow()
+{
+  std::vector<std::string_view> slots;
+  slots.swap(slots_);
+  slot_bits_ = slots.empty() ? 10 : slot_bits_ + 1;
+  slots_.resize(size_t(1) << slot_bits_);
+  size_t mask = slots_.size() - 1;
+  for (std::string_view str : slots) {
+    if (str.data()) {
+      size_t i = slotIndex(str);
+      while (slots_[i].data())
+        i = (i + 1) & mask;
+      slots_[i] = str;
+    }
+  }
+}
+
+// Remove the slot of pooled and shift the following slots in its probe
+// sequence back so lookups do not stop at the hole.
+void
+StringPool::eraseSlot(const char *pooled)
+{
+  size_t mask = slots_.size() - 1;
+  size_t i = slotIndex(view(pooled));
+  while (slots_[i].data() != pooled)
+    i = (i + 1) & mask;
+  for (size_t j = (i + 1) & mask; slots_[j].data(); j = (j + 1) & mask) {
+    size_t home = slotIndex(slots_[j]);
+    // Slot j can move to i if its home is not in (i, j].
+    bool stays = (i < j)
+      ? (i < home && home <= j)
+      : (i < home || home <= j);
+    if (!stays) {
+      slots_[i] = slots_[j];
+      i = j;
+    }
+  }
+  slots_[i] = std::string_view();
+}
+
+// Header, characters and terminator rounded up to the copy alignment.
+size_t
+StringPool::copyBytes(size_t length)
+{
+  size_t count = header_size_ + length + 1;
+  return (count + copy_align_ - 1) & ~(copy_align_ - 1);
+}
+
+const char *
+StringPool::copy(std::string_view str)
+{
+  size_t count = copyBytes(str.size());
+  size_t free_index = count / copy_align_;
+  char *chars;
+  if (free_index < free_lists_.size() && free_lists_[free_index]) {
+    chars = free_lists_[free_index];
+    std::memcpy(&free_lists_[free_index], chars, sizeof(char*));
+  }
+  else if (count > next_count_) {
+    // Strings larger than a block get a block of their own so the rest
+    // of the current block is not wasted.
+    size_t block_count = std::max(count, block_size_);
+    blocks_.push_back(std::make_unique_for_overwrite<char[]>(block_count));
+    block_bytes_ += block_count;
+    chars = blocks_.back().get();
+    if (count < block_size_) {
+      next_ = chars + count;
+      next_count_ = block_count - count;
+    }
+  }
+  else {
+    chars = next_;
+    next_ += count;
+    next_count_ -= count;
+  }
+  RefCount ref_count = 1;
+  std::memcpy(chars, &ref_count, sizeof(RefCount));
+  Length length = str.size();
+  std::memcpy(chars + sizeof(RefCount), &length, sizeof(Length));
+  chars += header_size_;
+  std::memcpy(chars, str.data(), str.size());
+  chars[str.size()] = '\0';
+  char_bytes_ += count;
+  return chars;
+}
+
+void
+StringPool::clear()
+{
+  blocks_.clear();
+  block_bytes_ = 0;
+  next_ = nullptr;
+  next_count_ = 0;
+  free_lists_.clear();
+  slots_.clear();
+  slot_bits_ = 0;
+  size_ = 0;
+  char_bytes_ = 0;
+}
+
+size_t
+StringPool::allocatedBytes() const
+{
+  return block_bytes_ + slots_.capacity() * sizeof(std::string_view)
+    + free_lists_.capacity() * sizeof(char*);
+}
+
+} // namespace sta